@@ -0,0 +1,102 @@
+/*------------------------------------------------------------------------------------------------------------------------------
+ *
+ * [FILE NAME]: adc.c
+ *
+ * [AUTHOR]:   Shady Ali
+ *
+ * [DESCRIPTION]: source file for the ADC module in AVR Micro controller
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+#include"adc.h"
+#include<stdio.h>
+
+/******************************************************************************************************
+ *                                               Global Variables                                     *
+ *****************************************************************************************************/
+/* Global variable to hold the address of the function that takes the results */
+static void (*volatile g_callBackPtr) (uint16)=NULL;
+/* Global variable to hold the flag of the timer event that triggers the conversions */
+static volatile uint8 g_triggerFlag=0;
+
+/*******************************************************************************************************
+ *                                               Interrupt Service Routines                            *
+ ******************************************************************************************************/
+ISR(ADC_vect)
+{
+	/* a conversion is only triggered by the rising edge of the flag of the timer event so clear it
+	 * by writing one to it , its interrupt is not enabled to clear it */
+	TIFR = g_triggerFlag;
+	if(g_callBackPtr != NULL){
+		(*g_callBackPtr)(ADC);
+	}
+}
+
+/*******************************************************************************************************
+ *                                              Functions Definitions                                  *
+ *******************************************************************************************************/
+
+/*
+ * Description : Function to initialize the ADC Driver
+ * 	1.set the reference voltage and the channel
+ * 	2.set the clock prescale
+ * 	3.set the auto trigger source
+ * 	4.enable the conversion complete interrupt and start the conversions
+ */
+/* the function takes one argument a structure of type : Adc_ConfigType */
+void ADC_init(const Adc_ConfigType *Config_Ptr)
+{
+	/************************** ADMUX Description **************************
+	 * REFS1:0 = the reference voltage (function argument)
+	 * ADLAR   = 0 right adjusted result
+	 * MUX4:0  = the single ended channel (function argument)
+	 ***********************************************************************/
+	ADMUX = ((Config_Ptr->reference & 0x03)<<REFS0) | (Config_Ptr->channel & 0x07);
+	/* insert the trigger source in the three bits ADTS2:0 of SFIOR */
+	SFIOR = (SFIOR & 0x1F) | ((Config_Ptr->trigger & 0x07)<<ADTS0);
+	/* the flag of the timer event that triggers the conversions */
+	if(Config_Ptr->trigger == TIMER0_COMPARE)
+	{
+		g_triggerFlag = (1<<OCF0);
+	}
+	else if(Config_Ptr->trigger == TIMER0_OVERFLOW)
+	{
+		g_triggerFlag = (1<<TOV0);
+	}
+	else if(Config_Ptr->trigger == TIMER1_COMPARE_B)
+	{
+		g_triggerFlag = (1<<OCF1B);
+	}
+	else if(Config_Ptr->trigger == TIMER1_OVERFLOW)
+	{
+		g_triggerFlag = (1<<TOV1);
+	}
+	else
+	{
+		g_triggerFlag = 0;
+	}
+	/************************** ADCSRA Description **************************
+	 * ADEN    = 1 enable the ADC
+	 * ADSC    = 1 start the first conversion (needed in the free running mode)
+	 * ADATE   = 1 auto trigger enable
+	 * ADIE    = 1 enable the conversion complete interrupt
+	 * ADPS2:0 = the clock prescale (function argument)
+	 ***********************************************************************/
+	ADCSRA = (1<<ADEN) | (1<<ADSC) | (1<<ADATE) | (1<<ADIE) | (Config_Ptr->clock & 0x07);
+}
+
+/*
+ * Description: Function to set the Call Back function address , it takes the result of every conversion.
+ */
+void ADC_setCallBack(void(*a_ptr)(uint16))
+{
+	/* Save the address of the Call back function in a global variable */
+	g_callBackPtr = a_ptr;
+}
+
+/*
+ * Description: Function to stop the conversions and turn off the ADC.
+ */
+void ADC_stop(void)
+{
+	ADCSRA = 0;
+}
@@ -0,0 +1,88 @@
+/*------------------------------------------------------------------------------------------------------------------------------
+ *
+ * [FILE NAME]: adc.h
+ *
+ * [AUTHOR]:   Shady Ali
+ *
+ * [DESCRIPTION]: header file for the ADC module in AVR Micro controller , the conversions are started by the
+ * 				  selected auto trigger source and every result is given to the call back function
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef ADC_H_
+#define ADC_H_
+
+#include"common_macros.h"
+#include"std_types.h"
+#include"micro_config.h"
+
+
+/***************************************************************************************
+ *                                 Types Declaration                                   *
+ **************************************************************************************/
+/*
+ * Description: enumeration to select the reference voltage of the ADC
+ */
+typedef enum
+{
+	AREF , AVCC , INTERNAL_REF=3
+}Adc_Reference;
+
+/*
+ * Description: enumeration to select the clock prescale of the ADC , the ADC clock should be
+ * between 50 KHz and 200 KHz for the full resolution
+ */
+typedef enum
+{
+	ADC_F_CPU_2=1 , ADC_F_CPU_4 , ADC_F_CPU_8 , ADC_F_CPU_16 , ADC_F_CPU_32 , ADC_F_CPU_64 , ADC_F_CPU_128
+}Adc_Clock;
+
+/*
+ * Description: enumeration to select the source that starts every conversion
+ */
+typedef enum
+{
+	FREE_RUNNING , ANALOG_COMPARATOR , EXTERNAL_INT0 , TIMER0_COMPARE , TIMER0_OVERFLOW ,
+	TIMER1_COMPARE_B , TIMER1_OVERFLOW , TIMER1_CAPTURE
+}Adc_Trigger;
+
+/* Description : structure to store the required information to initialize the ADC module
+ * the structure have 4 members
+ * 1. the reference voltage
+ * 2. prescale of the ADC clock
+ * 3. the source that starts every conversion
+ * 4. the channel (0 - 7) to be converted
+ */
+typedef struct
+{
+	Adc_Reference reference;  /* the reference voltage */
+	Adc_Clock clock;          /* prescale of the ADC clock */
+	Adc_Trigger trigger;      /* the auto trigger source */
+	uint8 channel;            /* the converted channel */
+}Adc_ConfigType;
+
+/**************************************************************************************
+ *                             Functions Prototypes                                   *
+ **************************************************************************************/
+
+/*
+ * Description : Function to initialize the ADC Driver
+ * 	1.set the reference voltage and the channel
+ * 	2.set the clock prescale
+ * 	3.set the auto trigger source
+ * 	4.enable the conversion complete interrupt and start the conversions
+ */
+/* the function takes one argument a structure of type : Adc_ConfigType */
+void ADC_init(const Adc_ConfigType *Config_Ptr);
+
+/*
+ * Description: Function to set the Call Back function address , it takes the result of every conversion.
+ */
+void ADC_setCallBack(void(*a_ptr)(uint16));
+
+/*
+ * Description: Function to stop the conversions and turn off the ADC.
+ */
+void ADC_stop(void);
+
+#endif /* ADC_H_ */
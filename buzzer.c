@@ -0,0 +1,160 @@
+  /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Buzzer
+ *
+ * [File Name]:buzzer.c
+ *
+ * [Description]: source file for the Buzzer service
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+#include"buzzer.h"
+#include"trace.h"
+#include<avr/pgmspace.h>
+
+/* a step with ticks = 0 ends the pattern , and with tone = BUZZER_LOOP it starts the pattern again */
+#define BUZZER_SILENCE 0
+#define BUZZER_LOOP 1
+
+/*
+ * Description: structure of one step of a pattern : the tone (OCR2 value or BUZZER_SILENCE)
+ * and for how many ticks it is played
+ */
+typedef struct
+{
+	uint8 tone;
+	uint8 ticks;
+}Buzzer_StepType;
+
+/* the steps of all the patterns , every pattern is ended by a step of zero ticks */
+static const Buzzer_StepType g_steps[] PROGMEM =
+{
+	/* BUZZER_CHIRP : a short beep for every pressed key */
+	{BUZZER_TONE(2000) , 5} , {BUZZER_SILENCE , 0} ,
+	/* BUZZER_SUCCESS : three rising beeps */
+	{BUZZER_TONE(1500) , 10} , {BUZZER_TONE(2000) , 10} , {BUZZER_TONE(3000) , 15} , {BUZZER_SILENCE , 0} ,
+	/* BUZZER_ALARM : two alternating tones until it is stopped */
+	{BUZZER_TONE(2000) , 31} , {BUZZER_TONE(1000) , 31} , {BUZZER_LOOP , 0}
+};
+
+/* the index of the first step of every pattern in g_steps */
+static const uint8 g_patternStart[] = {0 , 2 , 6};
+
+/* the playing pattern and its current step */
+static volatile bool g_playing = FALSE;
+static volatile Buzzer_Pattern g_pattern;
+static volatile uint8 g_step;
+/* ticks left of the current step */
+static volatile uint8 g_ticksLeft;
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: BUZZER_startStep
+ * [Description]:   function responsible for playing the current step , Timer 2 is restarted with the tone of the step
+ * 					or stopped for silence , it returns FALSE when the pattern is over
+ * [Args]: void
+ * [Returns]: bool
+ -----------------------------------------------------------------------------------------------------------------------------*/
+static bool BUZZER_startStep(void)
+{
+	Timer_ConfigType Timer_Config={timer2,CTC,F_CPU2_64,TOGGLE,NOT_USING2,0,0,0};
+	uint8 tone = pgm_read_byte(&g_steps[g_step].tone);
+	uint8 ticks = pgm_read_byte(&g_steps[g_step].ticks);
+	if(ticks == 0)
+	{
+		if(tone != BUZZER_LOOP)
+		{
+			return FALSE;
+		}
+		/* start the pattern again */
+		g_step = g_patternStart[g_pattern];
+		tone = pgm_read_byte(&g_steps[g_step].tone);
+		ticks = pgm_read_byte(&g_steps[g_step].ticks);
+	}
+	g_ticksLeft = ticks;
+	if(tone == BUZZER_SILENCE)
+	{
+		TIMER_stop(timer2);
+		CLEAR_BIT(BUZZER_PORT,BUZZER_PIN);
+	}
+	else
+	{
+		Timer_Config.s_timerCompareValue = tone;
+		TIMER_init(&Timer_Config);
+	}
+	return TRUE;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: BUZZER_init
+ * [Description]:   function responsible for initializing the buzzer pin as output and keeping the buzzer quiet
+ * [Args]: void
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void BUZZER_init(void)
+{
+	SET_BIT(BUZZER_DIR,BUZZER_PIN);
+	CLEAR_BIT(BUZZER_PORT,BUZZER_PIN);
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: BUZZER_play
+ * [Description]:   function responsible for starting to play a pattern , it is ignored if a pattern that comes
+ * 					after it in Buzzer_Pattern is playing so a key chirp does not interrupt the alarm
+ * [Args]: Buzzer_Pattern a_pattern
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void BUZZER_play(Buzzer_Pattern a_pattern)
+{
+	uint8 sreg = SREG; /* the pattern is also changed by the tick */
+	cli();
+	if((g_playing == FALSE) || (a_pattern >= g_pattern))
+	{
+		g_pattern = a_pattern;
+		g_step = g_patternStart[a_pattern];
+		g_playing = BUZZER_startStep();
+		TRACE_SIGNAL(TRACE_BUZZER,a_pattern + 1);
+	}
+	SREG = sreg;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: BUZZER_stop
+ * [Description]:   function responsible for stopping the playing pattern
+ * [Args]: void
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void BUZZER_stop(void)
+{
+	uint8 sreg = SREG;
+	cli();
+	g_playing = FALSE;
+	TIMER_stop(timer2);
+	CLEAR_BIT(BUZZER_PORT,BUZZER_PIN);
+	TRACE_SIGNAL(TRACE_BUZZER,0);
+	SREG = sreg;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: BUZZER_tick
+ * [Description]:   function responsible for moving to the next step of the playing pattern when the current step
+ * 					is over , it should be called every tick
+ * [Args]: void
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void BUZZER_tick(void)
+{
+	if(g_playing == FALSE)
+	{
+		return;
+	}
+	g_ticksLeft--;
+	if(g_ticksLeft == 0)
+	{
+		g_step++;
+		if(BUZZER_startStep() == FALSE)
+		{
+			BUZZER_stop();
+		}
+	}
+}
@@ -0,0 +1,43 @@
+ /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Buzzer
+ *
+ * [File Name]: buzzer.h
+ *
+ * [Description]: header file for the Buzzer service , the tones are generated by Timer 2 in CTC mode toggling
+ * 				  the OC2 pin so a playing pattern costs no CPU except one step change every few ticks
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef BUZZER_H_
+#define BUZZER_H_
+
+#include"common_macros.h"
+#include"micro_config.h"
+#include"std_types.h"
+#include"timer.h"
+
+#define BUZZER_PIN PD7    		    /* the buzzer is connected to OC2 */
+#define BUZZER_PORT PORTD		    /* the port register of the buzzer pin */
+#define BUZZER_DIR DDRD		        /* the port direction of the buzzer pin */
+
+/* Timer 2 is clocked by F_CPU/64 so the frequency of a tone is F_CPU / (2 * 64 * (1 + tone)) */
+#define BUZZER_TONE(FREQUENCY) ((uint8)((F_CPU / (2UL * 64UL * (FREQUENCY))) - 1))
+
+/*
+ * Description: enumeration of the patterns that can be played , a pattern can not interrupt a playing
+ * pattern that comes after it in this enumeration
+ */
+typedef enum
+{
+	BUZZER_CHIRP , BUZZER_SUCCESS , BUZZER_ALARM
+}Buzzer_Pattern;
+
+void BUZZER_init(void);                        /* function prototype for initializing the buzzer pin */
+void BUZZER_play(Buzzer_Pattern a_pattern);    /* function prototype for starting to play a pattern */
+void BUZZER_stop(void);                        /* function prototype for stopping the playing pattern */
+void BUZZER_tick(void);                        /* function prototype for playing the patterns , called every tick */
+
+#endif /* BUZZER_H_ */
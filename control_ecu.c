@@ -1,76 +1,80 @@
-/*------------------------------------------------------------------------------------------------------------------------------
- *
- * [FILE NAME]:  control_ecu
- *
- * [AUTHOR]:     Shady Ali
- *
- * [DATE] [CREATED]:  Dec 1, 2020
- *
- * [DESCRIPTION]: Control ECU for Door Locker System
- * 				  Using ATmega16 to control a DC MOTOR using L293D , a Buzzer , External EEPROM and its connected to
- * 				  the Human Interface ECU through UART module . It should take the password from the Human Interface
- * 				  ECU and process it , control the process of openning the door and Buzzer for security
- *
- -----------------------------------------------------------------------------------------------------------------------------*/
-
-#include"control_ecu_declerations.h"
-
-
-/************************************************************************************************
- * 										    Main Function					   					*
- ***********************************************************************************************/
-int main(void)
-{
-	/* Structure holding the required information for the initialization of TIMER module */
-	Timer_ConfigType Timer_Config={timer1,CTC,F_CPU_1024,NORMAL,NOT_USING2,0,1000,0};
-
-	/* Structure holding the required information for the initialization of UART module */
-	Uart_ConfigType Uart_Config={9600,interrupt,eight_bit,disable,one_bit};
-
-	/* Structure holding the required information for the initialization of I2C module  */
-	Twi_ConfigType Twi_Config={100000 , F_CPU_1 , 1  };
-
-	/* set the call back function for UART when the interrupt flag of receiving =1 */
-	UART_setCallBack(CONTROL_uartAppProcessing);
-
-	/* initializing the UART module and passing a structure for the required information */
-	UART_init(&Uart_Config);
-	/* initializing the external EEPROM with I2C and passing a structure for the required information */
-	EEPROM_init(&Twi_Config);
-	/* enabling the Global I-bit */
-	SET_BIT(SREG,7);
-	/* declare the Buzzer pin as output pin */
-	SET_BIT(BUZZER_DIR , BUZZER_PIN);
-	while(1)
-	{
-		while(g_select == 0); /* polling until receive an order from the HMI ECU though UART */
-		if(g_select == 1)
-		{
-			g_select=0;
-			/* write the password for the first time in the external EEPROM  */
-			EEPROM_writeArray(PASSWORD_ADDRESS , received_newPassword);
-		}
-		else if(g_select == 2)
-		{
-			/* when the receive byte from the HMI ECU is open door call the
-			 * function CONTROL_openDoor
-			 */
-			CONTROL_openDoor(&Timer_Config);
-		}
-		else if(g_select == 3)
-		{
-			/* when the receive byte from the HMI ECU is change password call the
-			 * function CONTROL_changePassword
-			 */
-			CONTROL_changePassword(&Timer_Config);
-		}
-		else if(g_select == 4)
-		{
-			/* when the receive byte from the HMI ECU is changed password call the
-			 * function CONTROL_setPassword to store the new password
-			 */
-			CONTROL_setPassword();
-		}
-
-	}
-}
+/*------------------------------------------------------------------------------------------------------------------------------
+ *
+ * [FILE NAME]:  control_ecu
+ *
+ * [AUTHOR]:     Shady Ali
+ *
+ * [DATE] [CREATED]:  Dec 1, 2020
+ *
+ * [DESCRIPTION]: Control ECU for Door Locker System
+ * 				  Using ATmega16 to control a DC MOTOR using L293D , a Buzzer , External EEPROM and its connected to
+ * 				  the Human Interface ECU through UART module . It should take the password from the Human Interface
+ * 				  ECU and process it , control the process of openning the door and Buzzer for security
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+
+#include"control_ecu_declerations.h"
+
+
+/************************************************************************************************
+ * 										    Main Function					   					*
+ ***********************************************************************************************/
+int main(void)
+{
+	/* event: variable to hold the event taken from the queue of the UART events */
+	uint8 event;
+	/* Structure holding the required information for the initialization of TIMER module
+	 * Timer 1 generates the system tick every TICK_MS milli seconds */
+	Timer_ConfigType Timer_Config={timer1,CTC,F_CPU_8,NORMAL,NOT_USING2,0,TICK_COMPARE_VALUE,0};
+
+	/* Structure holding the required information for the initialization of UART module */
+	Uart_ConfigType Uart_Config={9600,interrupt,eight_bit,disable,one_bit};
+
+	/* Structure holding the required information for the initialization of I2C module  */
+	Twi_ConfigType Twi_Config={100000 , F_CPU_1 , 1  };
+
+	/* set the call back function for UART when the interrupt flag of receiving =1 */
+	UART_setCallBack(CONTROL_uartAppProcessing);
+	/* set the call back function for the Timer module to count the ticks */
+	TIMER_setCallBack(CONTROL_tickProcessing);
+
+	/* initializing the UART module and passing a structure for the required information */
+	UART_init(&Uart_Config);
+	/* initializing the external EEPROM with I2C and passing a structure for the required information */
+	EEPROM_init(&Twi_Config);
+	/* keep the password record in RAM so the sessions do not wait for the I2C */
+	CONTROL_loadRecord();
+	TIMER_init(&Timer_Config); /* start the system tick */
+	/* enabling the Global I-bit */
+	SET_BIT(SREG,7);
+	/* declare the Buzzer pin as output pin */
+	BUZZER_init();
+	/* initializing the PWM of the door motor */
+	DCMOTOR_init();
+	/* initializing the end stop switches and the encoder of the door */
+	DOORPOS_setCallBack(CONTROL_doorArrived);
+	DOORPOS_init();
+	/* initializing the stall detection of the door motor */
+	CURRENT_setCallBack(CONTROL_motorStalled);
+	CURRENT_init();
+	/* the door is locked when the system starts */
+	FSM_init(&g_controlFsm , DOOR_LOCKED);
+#if TRACE_ENABLE
+	/* record the changes of the drivers and the transitions with their time in micro seconds */
+	TRACE_init(CONTROL_getTime);
+	FSM_setTraceHook(&g_controlFsm , CONTROL_traceTransition);
+#endif
+	LOG0(LOG_STARTED);
+	while(1)
+	{
+		/* take the requests received from the HMI ECU , every request runs to completion without waiting
+		 * for the door so the next request is served while the door is moving */
+		event = CONTROL_getEvent();
+		if(event != EVENT_NONE)
+		{
+			FSM_dispatch(&g_controlFsm , event);
+		}
+		/* move the open door cycle to its next state */
+		CONTROL_doorProcessing();
+	}
+}
@@ -1,127 +1,415 @@
-/*------------------------------------------------------------------------------------------------------------------------------
- *
- * [FILE NAME]:  hmi_ecu_declerations
- *
- * [AUTHOR]:   Shady Ali
- *
- * [DATE] [CREATED]:  Dec 6, 2020
- *
- * [DESCRIPTION]: header file for the functions of the Control ECU
- * 				  The file contain the Prototypes of functions for HMI_ECU and the Preprocessor macros
- * 				  and the Global variables
- *
- -----------------------------------------------------------------------------------------------------------------------------*/
-
-#ifndef CONTROL_ECU_DECLERATIONS_H_
-#define CONTROL_ECU_DECLERATIONS_H_
-
-#include"twi.h"
-#include"eeprom.h"
-#include"timer.h"
-#include"dcmotor.h"
-#include"uart.h"
-
-
-/************************************************************************************************
- * 										  PreProcessor Macros									*
- ***********************************************************************************************/
-#define NEW_PASSWORD 0x0A
-#define PASSWORD_IS_SAVED 0x0B
-#define CHANGE_PASSWORD 0x0C
-#define OPEN_DOOR 0x0D
-#define PASSWORD_IS_RIGHT 0x0E
-#define PASSWORD_IS_WRONG 0x0F
-#define PRECEDE_CHANGE 0x01
-#define DONT_CHANGE 0x02
-#define PASSWORD_IS_CHANGED 0x03
-#define PASSWORD_ADDRESS 0x0090
-
-#define BUZZER_PORT PORTC
-#define BUZZER_DIR DDRC
-#define BUZZER_PIN PC7
-
-/************************************************************************************************
- * 										Global Variables										*
- ***********************************************************************************************/
-
-/* global variable to indicate the received byte from the CONTROL ECU */
-extern volatile uint8 g_select;
-/* global variable to count the number of seconds for the Timer Module*/
-extern volatile uint8 g_numberOfSeconds;
-/* global array to hold the new password for the first time in the system */
-extern volatile uint8 received_newPassword[5];
-/* global array to hold temporery password to be checked */
-extern volatile uint8 received_tempPassword[5];
-/* global array to hold received password to change the existing one */
-extern volatile uint8 received_changePassword[5];
-/* global array to store the real password from the external EEPROM at it */
-extern volatile uint8 real_password[5];
-/* global variable to count how many times the password was entered wrong */
-extern volatile uint8 wrong_counter;
-
-
-/************************************************************************************************
- * 										  Function Prototypes									*
- ***********************************************************************************************/
-
-/* [Description]: the call back function for the Receive interrupt of the UART module for CONTROL ECU
- * 				  it should receive the byte and set the value for g_select variable indicating the mode
- * 				  and then receive the password
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void CONTROL_uartAppProcessing(void);
-/* [Description]: the call back function for the interrupt of Timer Module for the function open door for CONTROL ECU
- * 				  it should increment the number of seconds  and if the seconds =15 stops the motor
- * 				  and if it = 18 turn on the motor in the reverse direction
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void Control_timerOpenDoorProcessing(void);
-/* [Description]: the call back function for the interrupt of Timer Module for the function Buzzer on for CONTROL ECU
- * 				  it should increment the number of seconds  and if the seconds =60 it stops the buzzer
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void CONTROL_timerBuzzerProcessing(void);
-/* [Description]: function responsible for indicating if two arrays are equal or not
- * [Arguments]: it takes two arrays addresses and the size of the array
- * [Returns]: return 1 if the two arrays are equal
- * 			  return 0 if the two arrays are different
- */
-uint8 CONTROL_compare(uint8 *a_first , uint8 *a_second , uint8 a_arraySize);
-/* [Description]: function responsible for initializing the Timer module and turn on the Buzzer
- * [Arguments]: it takes a structure of type Timer_ConfigType to initialize the timer
- * [Returns]: no return
- */
-void CONTROL_buzzerOnForOneMinute(Timer_ConfigType *Timer_ConfigPtr);
-/* [Description]: function responsible for turning the buzzer off
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void CONTROL_buzzerOff(void);
-/* [Description]: function responsible for comparing the received password from the HMI ECU with the real password
- * 				  if it is equal send to the HMI ECU that password is right , initialize Timer module
- * 				  and turn on the motor in clock wise direction then stop the motor after 33 seconds
- * 				  if its wrong send to the HMI ECU that password is wrong and increment the wrong counter
- * 				  when the wrong ==3 turn on the Buzzer for one minute
- * [Arguments]: structure of type Timer_ConfigType holding the required information for Timer
- * [Returns]: no return
- */
-void CONTROL_openDoor(Timer_ConfigType *Timer_ConfigPtr);
-/* [Description]: function responsible for comparing the received password with the real password
- * 				  if it is right send to the HMI ECU to precede change
- * 				  and if it is wrong send to the HMI ECU not to change and increase the wrong counter
- * [Arguments]: structure of type Timer_ConfigType holding the required information for Timer
- * [Returns]: no return
- */
-void CONTROL_changePassword(Timer_ConfigType *Timer_ConfigPtr);
-/* [Description]: function responsible for writing the password to the external EEPROM
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void CONTROL_setPassword(void);
-
-
-
-#endif /* CONTROL_ECU_DECLERATIONS_H_ */
+/*------------------------------------------------------------------------------------------------------------------------------
+ *
+ * [FILE NAME]:  hmi_ecu_declerations
+ *
+ * [AUTHOR]:   Shady Ali
+ *
+ * [DATE] [CREATED]:  Dec 6, 2020
+ *
+ * [DESCRIPTION]: header file for the functions of the Control ECU
+ * 				  The file contain the Prototypes of functions for HMI_ECU and the Preprocessor macros
+ * 				  and the Global variables
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef CONTROL_ECU_DECLERATIONS_H_
+#define CONTROL_ECU_DECLERATIONS_H_
+
+#include"twi.h"
+#include"eeprom.h"
+#include"timer.h"
+#include"buzzer.h"
+#include"dcmotor.h"
+#include"doorpos.h"
+#include"current.h"
+#include"uart.h"
+#include"fsm.h"
+#include"queue.h"
+#include"latency.h"
+#include"trace.h"
+#include"probe.h"
+#include"log.h"
+
+
+/************************************************************************************************
+ * 										  PreProcessor Macros									*
+ ***********************************************************************************************/
+#define NEW_PASSWORD 0x0A
+#define PASSWORD_IS_SAVED 0x0B
+#define CHANGE_PASSWORD 0x0C
+#define OPEN_DOOR 0x0D
+#define PASSWORD_IS_RIGHT 0x0E
+#define PASSWORD_IS_WRONG 0x0F
+#define PRECEDE_CHANGE 0x01
+#define DONT_CHANGE 0x02
+#define PASSWORD_IS_CHANGED 0x03
+/* the digits of the password are streamed one byte each : PIN_DIGIT + the digit */
+#define PIN_DIGIT 0x30
+#define PIN_CLEAR 0x1C
+#define PIN_END 0x1D
+#define STATUS_QUERY 0x10
+#define SYSTEM_LOCKED 0x11
+#define SYSTEM_READY 0x12
+/* the CONTROL ECU tells the HMI ECU every change of the state of the door : DOOR_STATE followed by the state */
+#define DOOR_STATE 0x13
+#define DOOR_UNLOCKING 0
+#define DOOR_OPEN 1
+#define DOOR_LOCKING 2
+#define DOOR_LOCKED 3
+#define DOOR_FAULT 4
+/* the HMI ECU asks to stop the door at once or to keep it open for DOOR_EXTEND_HOLD_SECONDS */
+#define EMERGENCY_STOP 0x14
+#define EXTEND_HOLD 0x15
+/* a bench PC asks for the probes of the hot paths (probe.h) , it is answered only when PROBE_ENABLE is 1
+ * because the answer goes to the HMI ECU otherwise */
+#define PROBE_DUMP 0x16
+/* the histograms of the times , the counters and the UART errors are asked for , the answer is framed
+ * (CONTROL_sendDiagnostics) */
+#define DIAGNOSTICS 0x17
+/* set to 1 to answer DIAGNOSTICS , the UART is also the link between the ECUs so only on the bench */
+#define DIAGNOSTICS_ENABLE 0
+/* minimum and maximum number of digits of the password */
+#define PIN_MIN_LENGTH 4
+#define PIN_MAX_LENGTH 12
+/* the password record in the external EEPROM : the number of digits followed by the digits */
+#define PASSWORD_ADDRESS 0x0090
+#define PASSWORD_RECORD_SIZE (PIN_MAX_LENGTH + 1)
+
+/* number of wrong passwords in a row that locks the system */
+#define WRONG_PASSWORD_LIMIT 3
+/* the first lockout lasts LOCKOUT_BASE_SECONDS and every following lockout without a right password
+ * in between lasts double the previous one up to LOCKOUT_BASE_SECONDS << LOCKOUT_MAX_DOUBLINGS */
+#define LOCKOUT_BASE_SECONDS 60
+#define LOCKOUT_MAX_DOUBLINGS 4
+
+/* period of the system tick generated by Timer 1 in milli seconds */
+#define TICK_MS 8
+#define TICKS_PER_SECOND (1000/TICK_MS)
+/* compare value of Timer 1 clocked by F_CPU/8 for one tick */
+#define TICK_COMPARE_VALUE (((F_CPU/8)/1000)*TICK_MS - 1)
+
+/* the door stops when it arrives at an end , if it does not arrive within DOOR_TRAVEL_SECONDS the motor
+ * is stopped anyway , the door is held open for DOOR_HOLD_SECONDS */
+#define DOOR_TRAVEL_SECONDS 12
+#define DOOR_HOLD_SECONDS 3
+#define DOOR_CYCLE_SECONDS (2*DOOR_TRAVEL_SECONDS + DOOR_HOLD_SECONDS)
+#define DOOR_EXTEND_HOLD_SECONDS 10
+/* if the door is blocked while closing it is opened again and held , closing is tried DOOR_CLOSE_ATTEMPTS times */
+#define DOOR_CLOSE_ATTEMPTS 3
+/* speed profile of the door : the motor starts and ends the travel at DOOR_START_DUTY and ramps
+ * in DOOR_RAMP_TICKS to DOOR_CRUISE_DUTY for the middle of the travel */
+#define DOOR_START_DUTY 90
+#define DOOR_CRUISE_DUTY DCMOTOR_FULL_DUTY
+#define DOOR_RAMP_TICKS TICKS_PER_SECOND
+
+/* the states of the CONTROL ECU are the states of the door (DOOR_UNLOCKING .. DOOR_FAULT) */
+#define DOOR_STATES 5
+
+/* the events of the state machine of the CONTROL ECU , the requests are queued by the UART interrupt ,
+ * the end of the hold by the tick and the end of the motion is given by CONTROL_doorProcessing */
+#define EVENT_SET_PASSWORD 0      /* a new password is received */
+#define EVENT_OPEN_DOOR 1         /* a password is received to open the door */
+#define EVENT_CHANGE_PASSWORD 2   /* a password is received to change the password */
+#define EVENT_PASSWORD_CHANGED 3  /* the changed password is received */
+#define EVENT_STATUS 4            /* the HMI ECU asks for the status */
+#define EVENT_EXTEND_HOLD 5       /* the HMI ECU asks to keep the door open */
+#define EVENT_EMERGENCY_STOP 6    /* the HMI ECU stopped the door */
+#define EVENT_UNLOCK 7            /* the password to open the door is right */
+#define EVENT_MOTION_DONE 8       /* the motor stopped at the end of the motion */
+#define EVENT_MOTION_STALLED 9    /* the motor stalled before the door arrived */
+#define EVENT_CLOSE_FAILED 10     /* the door was opened again after the last attempt of closing it */
+#define EVENT_HOLD_OVER 11        /* the hold of the open door is over */
+#define EVENT_SESSION_OPEN 12     /* the first digit of a password to be checked is received */
+#define EVENT_PROBE_DUMP 13       /* the probes of the hot paths are asked for */
+#define EVENT_DIAGNOSTICS 14      /* the histograms of the times are asked for */
+#define CONTROL_EVENTS 15
+#define EVENT_NONE 0xFF
+/* number of events that can wait for the main loop , a power of 2 */
+#define EVENT_QUEUE_SIZE 8
+
+/* the stages of unlocking the door measured in micro seconds (g_latency) */
+#define LATENCY_PREFETCH 0   /* reading the real password from the external EEPROM */
+#define LATENCY_VERDICT 1    /* from the end of the password (PIN_END) to the result of the compare */
+#define LATENCY_MOTOR 2      /* from the end of the password to the start of the motor */
+#define LATENCY_REPLY 3      /* sending the result of the compare to the HMI ECU */
+#define LATENCY_STAGES 4
+
+/* the histograms of the times measured all the time in micro seconds (g_histograms) */
+#define HISTOGRAM_VERIFY 0      /* from the end of the password (PIN_END) to the result of the compare */
+#define HISTOGRAM_EEPROM 1      /* one transaction of the external EEPROM */
+#define HISTOGRAM_TURNAROUND 2  /* from the last byte of a request to the first byte of its reply */
+#define HISTOGRAM_UART_ISR 3    /* the receive interrupt of the UART */
+#define HISTOGRAMS 4
+
+/************************************************************************************************
+ * 										Types Declaration										*
+ ***********************************************************************************************/
+/* Description: structure of the counters of the use of the door since the start , they are the same for every
+ * 				door so the counters of many doors can be added together to compare the doors , they are sent
+ * 				in the answer of DIAGNOSTICS after the histograms in this order */
+typedef struct
+{
+	uint16 unlocks;         /* right passwords that opened the door */
+	uint16 wrongPasswords;  /* wrong passwords to open the door or to change the password */
+	uint16 lockouts;        /* times the system was locked */
+	uint16 emergencyStops;  /* times the door was stopped by the HMI ECU */
+	uint16 closeFailures;   /* times the door could not be closed */
+}Control_CountersType;
+
+/************************************************************************************************
+ * 										Global Variables										*
+ ***********************************************************************************************/
+
+/* global array to hold the password streamed from the HMI ECU (new , to be checked or changed) */
+extern volatile uint8 received_password[PIN_MAX_LENGTH];
+/* global variable holding the number of the received digits */
+extern volatile uint8 received_length;
+/* global array to store the real password from the external EEPROM at it */
+extern volatile uint8 real_password[PIN_MAX_LENGTH];
+/* global variable holding the number of digits of the real password */
+extern volatile uint8 real_length;
+/* global variable set when the real password of the session is read and the digits are checked on arrival */
+extern volatile bool g_recordReady;
+/* global variable set when a received digit of the session does not match the real password */
+extern volatile bool g_digitMismatch;
+/* global variable to count how many times the password was entered wrong */
+extern volatile uint8 wrong_counter;
+/* global variable holding the seconds left of the lockout , 0 when the system is not locked */
+extern volatile uint16 g_lockoutSeconds;
+/* the state machine of the CONTROL ECU , its state is the state of the door */
+extern Fsm_Type g_controlFsm;
+/* the statistics of the stages of unlocking the door */
+extern Latency_StatType g_latency[LATENCY_STAGES];
+/* the histograms of the times */
+extern Latency_HistogramType g_histograms[HISTOGRAMS];
+/* the counters of the use of the door */
+extern Control_CountersType g_counters;
+
+
+/************************************************************************************************
+ * 										  Function Prototypes									*
+ ***********************************************************************************************/
+
+/* [Description]: the call back function for the Receive interrupt of the UART module for CONTROL ECU
+ * 				  it should receive one byte of the command or the streamed password and queue an event
+ * 				  for the main loop when the end of the password is received , an emergency stop
+ * 				  stops the motor from the interrupt and is latched for CONTROL_doorProcessing
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_uartAppProcessing(void);
+/* [Description]: function responsible for taking the oldest event queued by the interrupts
+ * [Arguments]: no arguments
+ * [Returns]: the event or EVENT_NONE if there is no event
+ */
+uint8 CONTROL_getEvent(void);
+/* [Description]: function responsible for reading the ticks since the start , it is the time of the state machine
+ * [Arguments]: no arguments
+ * [Returns]: the ticks
+ */
+uint32 CONTROL_getTicks(void);
+/* [Description]: function responsible for reading the time since the start in counts of Timer 1 (1 us) , it is
+ * 				  the time of the latency of the stages of unlocking the door
+ * [Arguments]: no arguments
+ * [Returns]: the time
+ */
+uint32 CONTROL_getTime(void);
+/* [Description]: the trace hook of the state machine , it records the event and the next state of every
+ * 				  transition in the signal trace with the changes of the drivers
+ * [Arguments]: the state , the event and the next state of the transition
+ * [Returns]: no return
+ */
+void CONTROL_traceTransition(uint8 a_state , uint8 a_event , uint8 a_nextState);
+/* [Description]: the call back function of the Door Position driver , it stops the motor the instant the door
+ * 				  arrives at the end it is moving to
+ * [Arguments]: the end the door arrived at
+ * [Returns]: no return
+ */
+void CONTROL_doorArrived(DoorPos_Position a_position);
+/* [Description]: the call back function of the Motor Current service , it stops the motor the instant it stalls
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_motorStalled(void);
+/* [Description]: function responsible for starting to move the door to an end , the motion ends when the door
+ * 				  arrives , when the speed profile is over if the arrival is not detected or when the motor stalls
+ * [Arguments]: the direction of the motor and the end the door is moving to
+ * [Returns]: no return
+ */
+void CONTROL_startDoorMotion(DcMotor_Direction a_direction , DoorPos_Position a_target);
+/* [Description]: function responsible for finishing the motion of the door after the motor has stopped
+ * [Arguments]: no arguments
+ * [Returns]: FALSE if the motor stalled before the door arrived
+ */
+bool CONTROL_endDoorMotion(void);
+/* [Description]: function responsible for sending the state of the door to the HMI ECU when it is
+ * 				  locked or stopped
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_doorStateChanged(void);
+/* [Description]: function responsible for starting to open the locked door
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_unlockDoor(void);
+/* [Description]: function responsible for holding the door open for DOOR_HOLD_SECONDS
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_holdDoor(void);
+/* [Description]: function responsible for keeping the door open for DOOR_EXTEND_HOLD_SECONDS when the HMI ECU
+ * 				  asks for it
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_extendHold(void);
+/* [Description]: function responsible for starting to close the door when the hold is over
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_closeDoor(void);
+/* [Description]: function responsible for stopping the door while it is locking and opening it again
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_reopenDoor(void);
+/* [Description]: function responsible for opening the door again when something blocks it while it is locking
+ * 				  and counting the attempts of closing it
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_retryClose(void);
+/* [Description]: function responsible for leaving the door where the emergency stop stopped it
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_stopDoor(void);
+/* [Description]: function responsible for giving the events of the door to the state machine when the motion
+ * 				  is over or an emergency stop was requested , it is called by the main loop and it never
+ * 				  waits so the requests are served while the door is moving
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_doorProcessing(void);
+/* [Description]: function called every second of the tick for the lockout , it counts down the seconds left
+ * 				  and when the lockout is over it stops the buzzer
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_timerLockoutProcessing(void);
+/* [Description]: the call back function for the interrupt of Timer Module , it is called every tick
+ * 				  it queues EVENT_HOLD_OVER at the end of the hold of the door and calls the lockout processing
+ * 				  and the per second call back every second
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_tickProcessing(void);
+/* [Description]: function responsible for setting the function called by the tick every second
+ * [Arguments]: the address of the function or NULL to stop calling it
+ * [Returns]: no return
+ */
+void CONTROL_setSecondCallBack(void(*a_ptr)(void));
+/* [Description]: function responsible for indicating if two arrays are equal or not
+ * [Arguments]: it takes two arrays addresses and the size of the array
+ * [Returns]: return 1 if the two arrays are equal
+ * 			  return 0 if the two arrays are different
+ */
+uint8 CONTROL_compare(uint8 *a_first , uint8 *a_second , uint8 a_arraySize);
+/* [Description]: function responsible for reading the password record from the external EEPROM to RAM , the
+ * 				  record is read once when the system starts and kept in RAM while it matches the EEPROM
+ * 				  so a session never waits for the I2C
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_loadRecord(void);
+/* [Description]: function responsible for taking the real password record when a session of checking a
+ * 				  password is opened , the digits received before are compared at once and the next digits
+ * 				  are compared by the UART interrupt when they are received
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_prefetchRecord(void);
+/* [Description]: function responsible for giving the result of comparing the received password with the
+ * 				  real password , the digits are already compared so only the length is checked
+ * [Arguments]: no arguments
+ * [Returns]: return 1 if the received password is right
+ * 			  return 0 if it is wrong
+ */
+uint8 CONTROL_checkPassword(void);
+/* [Description]: function responsible for locking the system and turning on the Buzzer , the lockout is counted
+ * 				  down by the tick so the CONTROL ECU keeps serving the HMI ECU while it is locked
+ * 				  every lockout without a right password in between lasts double the previous one
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_startLockout(void);
+/* [Description]: function responsible for counting a wrong password and locking the system
+ * 				  when the password is entered wrong for WRONG_PASSWORD_LIMIT times
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_wrongPassword(void);
+/* [Description]: function responsible for reading the seconds left of the lockout , they are changed by the tick
+ * 				  so they are read with the interrupts disabled
+ * [Arguments]: no arguments
+ * [Returns]: the seconds left , 0 when the system is not locked
+ */
+uint16 CONTROL_getLockoutSeconds(void);
+/* [Description]: function responsible for sending a new state of the door to the HMI ECU
+ * [Arguments]: the state of the door (DOOR_UNLOCKING , DOOR_OPEN , DOOR_LOCKING , DOOR_LOCKED or DOOR_FAULT)
+ * [Returns]: no return
+ */
+void CONTROL_sendDoorState(uint8 a_state);
+/* [Description]: function responsible for sending the status of the system to the HMI ECU
+ * 				  SYSTEM_LOCKED followed by the seconds left (high byte first) or SYSTEM_READY
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_sendStatus(void);
+/* [Description]: function responsible for sending the histograms of the times , the counters of the use of the
+ * 				  door and the receive errors of the UART in one frame : DIAGNOSTICS , the length of the data , the
+ * 				  buckets of every histogram , the counters and the errors (every one high byte first) and the XOR
+ * 				  of the data
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_sendDiagnostics(void);
+/* [Description]: function responsible for sending the probes of the hot paths for the offline analysis
+ * 				  PROBE_DUMP followed by the number of probes and 3 bytes for every probe from the oldest :
+ * 				  the id , the high byte and the low byte of the counter of Timer 1
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_dumpProbes(void);
+/* [Description]: function responsible for turning the buzzer off
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_buzzerOff(void);
+/* [Description]: function responsible for comparing the received password from the HMI ECU with the real password
+ * 				  if it is equal give EVENT_UNLOCK to the state machine to start the open door cycle
+ * 				  then send to the HMI ECU that password is right
+ * 				  if its wrong send to the HMI ECU that password is wrong and count the wrong password
+ * 				  while the system is locked the status is sent instead of checking the password
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_openDoor(void);
+/* [Description]: function responsible for comparing the received password with the real password
+ * 				  if it is right send to the HMI ECU to precede change
+ * 				  and if it is wrong send to the HMI ECU not to change and count the wrong password
+ * 				  while the system is locked the status is sent instead of checking the password
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_changePassword(void);
+/* [Description]: function responsible for writing the received password record to the external EEPROM
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_setPassword(void);
+
+
+
+#endif /* CONTROL_ECU_DECLERATIONS_H_ */
@@ -1,255 +1,1026 @@
-/*------------------------------------------------------------------------------------------------------------------------------
- *
- * [FILE NAME]:  hmi_ecu_functions
- *
- * [AUTHOR]:   Shady Ali
- *
- * [DATE] [CREATED]:  Dec 5, 2020
- *
- * [DESCRIPTION]: source file for the functions of the Human Interface ECU
- * 				  The file contain the definitions of functions for HMI_ECU and the Global variables
- *
- -----------------------------------------------------------------------------------------------------------------------------*/
-
-#include"control_ecu_declerations.h"
-
-/************************************************************************************************
- * 										Global Variables										*
- ***********************************************************************************************/
-
-/* global variable to indicate the received byte from the CONTROL ECU */
-volatile uint8 g_select=0;
-/* global variable to count the number of seconds for the Timer Module*/
-volatile uint8 g_numberOfSeconds=0;
-/* global array to hold the new password for the first time in the system */
-volatile uint8 received_newPassword[5];
-/* global array to hold temporery password to be checked */
-volatile uint8 received_tempPassword[5];
-/* global array to hold received password to change the existing one */
-volatile uint8 received_changePassword[5];
-/* global array to store the real password from the external EEPROM at it */
-volatile uint8 real_password[5];
-/* global variable to count how many times the password was entered wrong */
-volatile uint8 wrong_counter=0;
-
-/************************************************************************************************
- * 										  Function Definitions									*
- ***********************************************************************************************/
-
-/* [Description]: the call back function for the Receive interrupt of the UART module for CONTROL ECU
- * 				  it should receive the byte and set the value for g_select variable indicating the mode
- * 				  and then receive the password
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void CONTROL_uartAppProcessing(void)
-{
-	/* variable to hold the received byte indicating which mode */
-	uint8 key = UART_receiveByte();
-	/* condition to select the mode of CONTROL ECU */
-	if(key == NEW_PASSWORD)
-	{
-		/* set the global variable g_select to 1 to if the HMI ECU wants to set new password */
-		g_select=1;
-		/* receive the new password */
-		UART_receiveArray(received_newPassword ,5);
-	}
-	else if(key == OPEN_DOOR)
-	{
-		/* set the global variable g_select to 2 the HMI ECU wants to open the door */
-		g_select=2;
-		/* receive input password from the HMI ECU */
-		UART_receiveArray(received_tempPassword , 5);
-	}
-	else if(key == CHANGE_PASSWORD)
-	{
-		/* set the global variable g_select to 3 if the HMI ECU wants to change the password */
-		g_select=3;
-		/* receive input password from the HMI ECU */
-		UART_receiveArray(received_tempPassword , 5);
-	}
-	else if(key == PASSWORD_IS_CHANGED)
-	{
-		/* set the global variable g_select to 4 if the password is changed from the HMI ECU */
-		g_select=4;
-		/* receive the changed password */
-		UART_receiveArray(received_changePassword , 5);
-	}
-}
-
-/* [Description]: the call back function for the interrupt of Timer Module for the function open door for CONTROL ECU
- * 				  it should increment the number of seconds  and if the seconds =15 stops the motor
- * 				  and if it = 18 turn on the motor in the reverse direction
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void Control_timerOpenDoorProcessing(void)
-{
-	/* increment the seconds when the flag of Timer =1 */
-	g_numberOfSeconds++;
-	if(g_numberOfSeconds==15)
-	{
-		/* at the 15 second stop the motor */
-		DCMOTOR_stop();
-	}
-	else if(g_numberOfSeconds==18)
-	{
-		/* at the 18 second start the motor in reverse direction */
-		DCMOTOR_acw();
-	}
-}
-
-/* [Description]: the call back function for the interrupt of Timer Module for the function Buzzer on for CONTROL ECU
- * 				  it should increment the number of seconds  and if the seconds =60 it stops the buzzer
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void CONTROL_timerBuzzerProcessing(void)
-{
-	/* increment the seconds when the flag of Timer =1 */
-	g_numberOfSeconds++;
-	if(g_numberOfSeconds == 60)
-	{
-		/* after one minute turn off the buzzer */
-		CONTROL_buzzerOff();
-	}
-}
-
-/* [Description]: function responsible for indicating if two arrays are equal or not
- * [Arguments]: it takes two arrays addresses and the size of the array
- * [Returns]: return 1 if the two arrays are equal
- * 			  return 0 if the two arrays are different
- */
-uint8 CONTROL_compare(uint8 *a_first , uint8 *a_second , uint8 a_arraySize)
-{
-	/* incremental variable for the for loop */
-	uint8 i=0;
-	for(i=0;i<a_arraySize;i++)
-	{
-		/* condition to compare each elements of the two arrays */
-		if(a_first[i] != a_second[i])
-		{
-			return 0;
-		}
-	}
-	return 1;
-}
-
-/* [Description]: function responsible for initializing the Timer module and turn on the Buzzer
- * [Arguments]: it takes a structure of type Timer_ConfigType to initialize the timer
- * [Returns]: no return
- */
-void CONTROL_buzzerOnForOneMinute(Timer_ConfigType *Timer_ConfigPtr)
-{
-	BUZZER_DIR |=(1<<BUZZER_PIN); /* initialize the buzzer pin as output pin */
-	/* initialize the Timer and give it a structure holding the required information */
-	TIMER_init(Timer_ConfigPtr);
-	/* set the call back function for the Timer module */
-	TIMER_setCallBack(CONTROL_timerBuzzerProcessing);
-	g_numberOfSeconds=0;
-	BUZZER_PORT |=(1<<BUZZER_PIN);  /* turn on the Buzzer */
-	while(g_numberOfSeconds != 60); /* polling for one minute */
-}
-
-/* [Description]: function responsible for turning the buzzer off
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void CONTROL_buzzerOff(void)
-{
-	BUZZER_PORT &= (~(1<<BUZZER_PIN)); /* turn off the buzzer */
-}
-
-
-/* [Description]: function responsible for comparing the received password from the HMI ECU with the real password
- * 				  if it is equal send to the HMI ECU that password is right , initialize Timer module
- * 				  and turn on the motor in clock wise direction then stop the motor after 33 seconds
- * 				  if its wrong send to the HMI ECU that password is wrong and increment the wrong counter
- * 				  when the wrong ==3 turn on the Buzzer for one minute
- * [Arguments]: structure of type Timer_ConfigType holding the required information for Timer
- * [Returns]: no return
- */
-void CONTROL_openDoor(Timer_ConfigType *Timer_ConfigPtr)
-{
-	/* variable to hold the result of comparision */
-	uint8 temp;
-	g_select=0;
-	/* read the real password from the external  EEPROM and store it in the array real_password */
-	EEPROM_readArray(PASSWORD_ADDRESS , real_password);
-	/* compare between the entered password and the real one  ,and store the result in temp variable */
-	temp= CONTROL_compare(received_tempPassword,real_password , 5);
-	if(temp == 1)
-	{
-		/* send to the HMI ECU that the entered password is right */
-		UART_sendByte(PASSWORD_IS_RIGHT);
-		TIMER_init(Timer_ConfigPtr); /* initialize the Timer */
-		TIMER_setCallBack(Control_timerOpenDoorProcessing); /* set the call back function for the Timer module */
-		g_numberOfSeconds=0;
-		DCMOTOR_cw(); /* turn on the motor in clock wise direction to open the door */
-		while(g_numberOfSeconds != 33);/* polling for the required time for the door to open and close */
-		g_numberOfSeconds=0;
-		DCMOTOR_stop(); /* stop the motor after 33 second*/
-		TIMER_stop(Timer_ConfigPtr->timer); /* stop the Timer */
-	}
-	else if(temp == 0)
-	{
-		/* if the entered password does not match with the real password send to the HMI ECU  that password is wrong*/
-		UART_sendByte(PASSWORD_IS_WRONG);
-		/* increment the wrong counter */
-		wrong_counter++;
-		if(wrong_counter==3)
-		{
-			/* if the entered password is wrong for 3 times activate the Buzzer for one minute */
-			CONTROL_buzzerOnForOneMinute(Timer_ConfigPtr);
-			wrong_counter=0;
-		}
-	}
-}
-
-/* [Description]: function responsible for comparing the received password with the real password
- * 				  if it is right send to the HMI ECU to precede change
- * 				  and if it is wrong send to the HMI ECU not to change and increase the wrong counter
- * [Arguments]: structure of type Timer_ConfigType holding the required information for Timer
- * [Returns]: no return
- */
-void CONTROL_changePassword(Timer_ConfigType *Timer_ConfigPtr)
-{
-	/* variable to hold the result of comparision */
-	uint8 temp;
-	g_select=0;
-	/* read the real password from the external  EEPROM and store it in the array real_password */
-	EEPROM_readArray(PASSWORD_ADDRESS , real_password);
-	/* compare between the entered password and the real one  ,and store the result in temp variable */
-	temp= CONTROL_compare(received_tempPassword,real_password, 5);
-	if(temp == 1)
-	{
-		/* if the entered password matches the real password send to the HMI ECU to precede change */
-		UART_sendByte(PRECEDE_CHANGE);
-	}
-	else if(temp == 0)
-	{
-		/* if the entered password does not matches the real password send to the HMI ECU to dont change*/
-		UART_sendByte(DONT_CHANGE);
-		wrong_counter++; /* increment the wrong counter */
-		if(wrong_counter == 3)
-		{
-			/* if the entered password is wrong for 3 times activate the Buzzer for one minute */
-			CONTROL_buzzerOnForOneMinute(Timer_ConfigPtr);
-			wrong_counter=0;
-		}
-	}
-}
-
-/* [Description]: function responsible for writing the password to the external EEPROM
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void CONTROL_setPassword(void)
-{
-	g_select=0;
-	/* write the new password to the external EEPROM */
-	EEPROM_writeArray(PASSWORD_ADDRESS ,received_changePassword );
-
-}
-
-
+/*------------------------------------------------------------------------------------------------------------------------------
+ *
+ * [FILE NAME]:  hmi_ecu_functions
+ *
+ * [AUTHOR]:   Shady Ali
+ *
+ * [DATE] [CREATED]:  Dec 5, 2020
+ *
+ * [DESCRIPTION]: source file for the functions of the Human Interface ECU
+ * 				  The file contain the definitions of functions for HMI_ECU and the Global variables
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+
+#include"control_ecu_declerations.h"
+#include<stdio.h>
+#include<avr/pgmspace.h>
+
+/************************************************************************************************
+ * 										Global Variables										*
+ ***********************************************************************************************/
+
+/* global array to hold the password streamed from the HMI ECU (new , to be checked or changed) */
+volatile uint8 received_password[PIN_MAX_LENGTH];
+/* global variable holding the number of the received digits */
+volatile uint8 received_length=0;
+/* global array to store the real password from the external EEPROM at it */
+volatile uint8 real_password[PIN_MAX_LENGTH];
+/* global variable holding the number of digits of the real password */
+volatile uint8 real_length=0;
+/* the password record of the external EEPROM kept in RAM : the number of digits followed by the digits */
+static uint8 g_passwordRecord[PASSWORD_RECORD_SIZE];
+/* variable set when g_passwordRecord holds the same record as the external EEPROM */
+static bool g_recordLoaded=FALSE;
+/* global variable set when the real password of the session is read and the digits are checked on arrival */
+volatile bool g_recordReady=FALSE;
+/* global variable set when a received digit of the session does not match the real password */
+volatile bool g_digitMismatch=FALSE;
+/* variable holding the command of the password being streamed */
+static volatile uint8 g_receivedCommand=0;
+/* global variable to count how many times the password was entered wrong */
+volatile uint8 wrong_counter=0;
+/* global variable holding the seconds left of the lockout , 0 when the system is not locked */
+volatile uint16 g_lockoutSeconds=0;
+/* variable counting the lockouts since the last right password for the exponential backoff */
+static uint8 g_lockoutCount=0;
+/* variable to hold the address of the function called by the tick every second */
+static void (*volatile g_secondCallBackPtr) (void)=NULL;
+/* variable to count the ticks of the current second */
+static volatile uint8 g_ticksOfSecond=0;
+/* variable set by the Motor Current service when the motor stalls */
+static volatile bool g_motorStalled=FALSE;
+/* flag set when the motor stalled in the deceleration of the profile (at the end of the travel) */
+static volatile bool g_stalledAtEnd=FALSE;
+/* variable latched by the UART interrupt when it stops the motor for an emergency stop , it is taken by
+ * CONTROL_doorProcessing before the end of the motion so a stopped door is never taken as arrived */
+static volatile bool g_stopRequested=FALSE;
+/* the events queued by the UART and the Timer interrupts for the main loop */
+static uint8 g_eventBuffer[EVENT_QUEUE_SIZE];
+static Queue_Type g_eventQueue=QUEUE_INITIALIZER(g_eventBuffer);
+/* the ticks since the start and the ticks spent in every state */
+static volatile uint32 g_ticks=0;
+static uint32 g_stateTicks[DOOR_STATES];
+/* the statistics of the stages of unlocking the door */
+Latency_StatType g_latency[LATENCY_STAGES];
+/* the counters of the use of the door */
+Control_CountersType g_counters;
+/* the histograms of the times */
+Latency_HistogramType g_histograms[HISTOGRAMS];
+/* the time the last byte of a request was received and a flag set until the first byte of its reply is sent */
+static volatile uint32 g_requestTime=0;
+static volatile bool g_replyPending=FALSE;
+/* the time the end of the password was received and a flag set until the start of the motor is measured */
+static volatile uint32 g_pinEndTime=0;
+static bool g_unlockMeasured=FALSE;
+/* the ticks left of holding the door open and the attempts of closing it */
+static volatile uint16 g_holdTicks=0;
+static uint8 g_closeAttempts=0;
+/* speed profile of the door motor for opening and closing */
+static const DcMotor_ProfileType g_doorProfile={DOOR_START_DUTY,DOOR_CRUISE_DUTY,DOOR_RAMP_TICKS,
+		(DOOR_TRAVEL_SECONDS*TICKS_PER_SECOND) - (2*DOOR_RAMP_TICKS),DOOR_RAMP_TICKS};
+
+/* function responsible for setting the ticks of holding the door open */
+static void CONTROL_setHold(uint8 a_seconds);
+/* function responsible for sending the first byte of the reply of a request */
+static void CONTROL_sendReply(uint8 a_reply);
+/* function responsible for sending a 16-bit value of the diagnostics and adding it to the checksum */
+static void CONTROL_sendWord(uint16 a_word , uint8 *a_checksum_Ptr);
+
+/* the transition table of the CONTROL ECU , one row for every state of the door and one column for every event
+ * the requests are served in every state and the door is moved by the events of its state */
+static const Fsm_TransitionType g_controlTable[DOOR_STATES*CONTROL_EVENTS] PROGMEM=
+{
+	/* DOOR_UNLOCKING */
+	{DOOR_UNLOCKING , CONTROL_setPassword} , {DOOR_UNLOCKING , CONTROL_openDoor} ,
+	{DOOR_UNLOCKING , CONTROL_changePassword} , {DOOR_UNLOCKING , CONTROL_setPassword} ,
+	{DOOR_UNLOCKING , CONTROL_sendStatus} , FSM_IGNORED , {DOOR_FAULT , CONTROL_stopDoor} , FSM_IGNORED ,
+	{DOOR_OPEN , CONTROL_holdDoor} , {DOOR_OPEN , CONTROL_holdDoor} , {DOOR_FAULT , CONTROL_doorStateChanged} ,
+	FSM_IGNORED , {DOOR_UNLOCKING , CONTROL_prefetchRecord} ,
+	{DOOR_UNLOCKING , CONTROL_dumpProbes} , {DOOR_UNLOCKING , CONTROL_sendDiagnostics} ,
+	/* DOOR_OPEN */
+	{DOOR_OPEN , CONTROL_setPassword} , {DOOR_OPEN , CONTROL_openDoor} ,
+	{DOOR_OPEN , CONTROL_changePassword} , {DOOR_OPEN , CONTROL_setPassword} ,
+	{DOOR_OPEN , CONTROL_sendStatus} , {DOOR_OPEN , CONTROL_extendHold} , {DOOR_FAULT , CONTROL_stopDoor} ,
+	{DOOR_OPEN , CONTROL_holdDoor} , FSM_IGNORED , FSM_IGNORED , FSM_IGNORED ,
+	{DOOR_LOCKING , CONTROL_closeDoor} , {DOOR_OPEN , CONTROL_prefetchRecord} ,
+	{DOOR_OPEN , CONTROL_dumpProbes} , {DOOR_OPEN , CONTROL_sendDiagnostics} ,
+	/* DOOR_LOCKING */
+	{DOOR_LOCKING , CONTROL_setPassword} , {DOOR_LOCKING , CONTROL_openDoor} ,
+	{DOOR_LOCKING , CONTROL_changePassword} , {DOOR_LOCKING , CONTROL_setPassword} ,
+	{DOOR_LOCKING , CONTROL_sendStatus} , {DOOR_UNLOCKING , CONTROL_reopenDoor} , {DOOR_FAULT , CONTROL_stopDoor} ,
+	{DOOR_UNLOCKING , CONTROL_reopenDoor} , {DOOR_LOCKED , CONTROL_doorStateChanged} ,
+	{DOOR_UNLOCKING , CONTROL_retryClose} , FSM_IGNORED , FSM_IGNORED , {DOOR_LOCKING , CONTROL_prefetchRecord} ,
+	{DOOR_LOCKING , CONTROL_dumpProbes} , {DOOR_LOCKING , CONTROL_sendDiagnostics} ,
+	/* DOOR_LOCKED */
+	{DOOR_LOCKED , CONTROL_setPassword} , {DOOR_LOCKED , CONTROL_openDoor} ,
+	{DOOR_LOCKED , CONTROL_changePassword} , {DOOR_LOCKED , CONTROL_setPassword} ,
+	{DOOR_LOCKED , CONTROL_sendStatus} , FSM_IGNORED , FSM_IGNORED , {DOOR_UNLOCKING , CONTROL_unlockDoor} ,
+	FSM_IGNORED , FSM_IGNORED , FSM_IGNORED , FSM_IGNORED , {DOOR_LOCKED , CONTROL_prefetchRecord} ,
+	{DOOR_LOCKED , CONTROL_dumpProbes} , {DOOR_LOCKED , CONTROL_sendDiagnostics} ,
+	/* DOOR_FAULT */
+	{DOOR_FAULT , CONTROL_setPassword} , {DOOR_FAULT , CONTROL_openDoor} ,
+	{DOOR_FAULT , CONTROL_changePassword} , {DOOR_FAULT , CONTROL_setPassword} ,
+	{DOOR_FAULT , CONTROL_sendStatus} , FSM_IGNORED , FSM_IGNORED , {DOOR_UNLOCKING , CONTROL_unlockDoor} ,
+	FSM_IGNORED , FSM_IGNORED , FSM_IGNORED , FSM_IGNORED , {DOOR_FAULT , CONTROL_prefetchRecord} ,
+	{DOOR_FAULT , CONTROL_dumpProbes} , {DOOR_FAULT , CONTROL_sendDiagnostics}
+};
+
+/* the state machine of the CONTROL ECU , it is started by the main function */
+Fsm_Type g_controlFsm={g_controlTable , CONTROL_EVENTS , CONTROL_getTicks , g_stateTicks , NULL , DOOR_LOCKED , 0};
+
+/************************************************************************************************
+ * 										  Function Definitions									*
+ ***********************************************************************************************/
+
+/* [Description]: the call back function for the Receive interrupt of the UART module for CONTROL ECU
+ * 				  it should receive one byte of the command or the streamed password and queue an event
+ * 				  for the main loop when the end of the password is received , an emergency stop
+ * 				  stops the motor from the interrupt and is latched for CONTROL_doorProcessing
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_uartAppProcessing(void)
+{
+	/* variable to hold the received byte */
+	uint8 key = UART_receiveByte();
+	uint32 start = CONTROL_getTime();
+	if((key == NEW_PASSWORD) || (key == OPEN_DOOR) || (key == CHANGE_PASSWORD) || (key == PASSWORD_IS_CHANGED))
+	{
+		/* the password of this command will be streamed after it so drop any digits received before */
+		g_receivedCommand = key;
+		received_length = 0;
+		g_digitMismatch = FALSE;
+		g_recordReady = FALSE;
+		if((key == OPEN_DOOR) || (key == CHANGE_PASSWORD))
+		{
+			/* the HMI ECU sends the command with the first digit so read the real password
+			 * while the next digits are typed */
+			QUEUE_put(&g_eventQueue , EVENT_SESSION_OPEN);
+		}
+	}
+	else if((key >= PIN_DIGIT) && (key <= (PIN_DIGIT + 9)))
+	{
+		/* store the received digit of the password */
+		if(received_length < PIN_MAX_LENGTH)
+		{
+			received_password[received_length] = key - PIN_DIGIT;
+			/* compare the digit at once when the real password is read */
+			if((g_recordReady == TRUE) && ((received_length >= real_length) ||
+					(received_password[received_length] != real_password[received_length])))
+			{
+				g_digitMismatch = TRUE;
+			}
+			received_length++;
+		}
+		BUZZER_play(BUZZER_CHIRP); /* a beep for every pressed key */
+	}
+	else if(key == PIN_CLEAR)
+	{
+		/* the digits were cleared on the KeyPad , without a valid real password every password stays wrong */
+		received_length = 0;
+		g_digitMismatch = ((g_recordReady == TRUE) && (real_length < PIN_MIN_LENGTH));
+	}
+	else if(key == STATUS_QUERY)
+	{
+		/* the HMI ECU asks for the status of the system */
+		g_requestTime = start;
+		g_replyPending = TRUE;
+		QUEUE_put(&g_eventQueue , EVENT_STATUS);
+	}
+	else if(key == EMERGENCY_STOP)
+	{
+		/* stop the motor at once , the door state is changed by the main loop */
+		DCMOTOR_stop();
+		g_stopRequested = TRUE;
+	}
+	else if(key == EXTEND_HOLD)
+	{
+		QUEUE_put(&g_eventQueue , EVENT_EXTEND_HOLD);
+	}
+#if PROBE_ENABLE
+	else if(key == PROBE_DUMP)
+	{
+		/* only on the bench , the HMI ECU would take the bytes of the answer as replies */
+		QUEUE_put(&g_eventQueue , EVENT_PROBE_DUMP);
+	}
+#endif
+#if DIAGNOSTICS_ENABLE
+	else if(key == DIAGNOSTICS)
+	{
+		QUEUE_put(&g_eventQueue , EVENT_DIAGNOSTICS);
+	}
+#endif
+	else if(key == PIN_END)
+	{
+		g_pinEndTime = start;
+		if((g_receivedCommand == OPEN_DOOR) || (g_receivedCommand == CHANGE_PASSWORD))
+		{
+			/* these passwords are answered by the CONTROL ECU */
+			g_requestTime = start;
+			g_replyPending = TRUE;
+		}
+		/* condition to select the event of CONTROL ECU when the password is complete */
+		if(g_receivedCommand == NEW_PASSWORD)
+		{
+			/* the HMI ECU wants to set new password */
+			QUEUE_put(&g_eventQueue , EVENT_SET_PASSWORD);
+		}
+		else if(g_receivedCommand == OPEN_DOOR)
+		{
+			/* the HMI ECU wants to open the door */
+			QUEUE_put(&g_eventQueue , EVENT_OPEN_DOOR);
+		}
+		else if(g_receivedCommand == CHANGE_PASSWORD)
+		{
+			/* the HMI ECU wants to change the password */
+			QUEUE_put(&g_eventQueue , EVENT_CHANGE_PASSWORD);
+		}
+		else if(g_receivedCommand == PASSWORD_IS_CHANGED)
+		{
+			/* the password is changed from the HMI ECU */
+			QUEUE_put(&g_eventQueue , EVENT_PASSWORD_CHANGED);
+		}
+		g_receivedCommand = 0;
+	}
+	LATENCY_addToHistogram(&g_histograms[HISTOGRAM_UART_ISR] , CONTROL_getTime() - start);
+}
+
+/* [Description]: function responsible for taking the oldest event queued by the interrupts
+ * [Arguments]: no arguments
+ * [Returns]: the event or EVENT_NONE if there is no event
+ */
+uint8 CONTROL_getEvent(void)
+{
+	uint8 event;
+	if(QUEUE_get(&g_eventQueue , &event) == FALSE)
+	{
+		return EVENT_NONE;
+	}
+	return event;
+}
+
+/* [Description]: function responsible for reading the time since the start in counts of Timer 1 (1 us) , it is
+ * 				  the time of the latency of the stages of unlocking the door , a tick that is due but not
+ * 				  counted yet is added
+ * [Arguments]: no arguments
+ * [Returns]: the time
+ */
+uint32 CONTROL_getTime(void)
+{
+	uint32 ticks;
+	uint16 counts;
+	uint8 sreg = SREG;
+	cli();
+	ticks = g_ticks;
+	counts = TCNT1;
+	if(BIT_IS_SET(TIFR,OCF1A) && (counts < (TICK_COMPARE_VALUE/2)))
+	{
+		ticks++;
+	}
+	SREG = sreg;
+	return (ticks * (TICK_COMPARE_VALUE + 1)) + counts;
+}
+
+/* [Description]: the trace hook of the state machine , it records the event and the next state of every
+ * 				  transition in the signal trace with the changes of the drivers
+ * [Arguments]: the state , the event and the next state of the transition
+ * [Returns]: no return
+ */
+void CONTROL_traceTransition(uint8 a_state , uint8 a_event , uint8 a_nextState)
+{
+	(void)a_state; /* the state before the transition is the state of the previous record */
+#if (TRACE_ENABLE == 0)
+	(void)a_event;
+	(void)a_nextState;
+#endif
+	TRACE_SIGNAL(TRACE_FSM_EVENT , a_event);
+	TRACE_SIGNAL(TRACE_FSM_STATE , a_nextState);
+}
+
+/* [Description]: function responsible for reading the ticks since the start , it is the time of the state machine
+ * [Arguments]: no arguments
+ * [Returns]: the ticks
+ */
+uint32 CONTROL_getTicks(void)
+{
+	uint32 ticks;
+	uint8 sreg = SREG;
+	cli();
+	ticks = g_ticks;
+	SREG = sreg;
+	return ticks;
+}
+
+/* [Description]: the call back function of the Door Position driver , it stops the motor the instant the door
+ * 				  arrives at the end it is moving to
+ * [Arguments]: the end the door arrived at
+ * [Returns]: no return
+ */
+void CONTROL_doorArrived(DoorPos_Position a_position)
+{
+	(void)a_position; /* the door was only armed for the end it is moving to */
+	DCMOTOR_stop();
+}
+
+/* [Description]: the call back function of the Motor Current service , it stops the motor the instant it stalls
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_motorStalled(void)
+{
+	g_stalledAtEnd = DCMOTOR_isDecelerating();
+	DCMOTOR_stop();
+	g_motorStalled=TRUE;
+}
+
+/* [Description]: function responsible for starting to move the door to an end , the motion ends when the door
+ * 				  arrives , when the speed profile is over if the arrival is not detected or when the motor stalls
+ * [Arguments]: the direction of the motor and the end the door is moving to
+ * [Returns]: no return
+ */
+void CONTROL_startDoorMotion(DcMotor_Direction a_direction , DoorPos_Position a_target)
+{
+	g_motorStalled=FALSE;
+	g_stalledAtEnd=FALSE;
+	if(DOORPOS_arm(a_target) == TRUE)
+	{
+		return; /* the door is already there so the motion ends at once */
+	}
+	CURRENT_start();
+	DCMOTOR_move(a_direction , &g_doorProfile);
+}
+
+/* [Description]: function responsible for finishing the motion of the door after the motor has stopped
+ * [Arguments]: no arguments
+ * [Returns]: FALSE if the motor stalled before the door arrived
+ */
+bool CONTROL_endDoorMotion(void)
+{
+	CURRENT_stop();
+	DOORPOS_arm(DOORPOS_BETWEEN);
+	return (g_motorStalled == FALSE);
+}
+
+/* [Description]: function responsible for setting the ticks of holding the door open , they are counted
+ * 				  down by the tick and EVENT_HOLD_OVER is queued at the end , 0 cancels the hold
+ * [Arguments]: the seconds of the hold
+ * [Returns]: no return
+ */
+static void CONTROL_setHold(uint8 a_seconds)
+{
+	uint8 sreg = SREG; /* the ticks are counted down by the tick */
+	cli();
+	g_holdTicks = (uint16)a_seconds * TICKS_PER_SECOND;
+	SREG = sreg;
+}
+
+/* [Description]: function responsible for sending the state of the door to the HMI ECU when it is
+ * 				  locked or stopped
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_doorStateChanged(void)
+{
+	CONTROL_sendDoorState(FSM_getState(&g_controlFsm));
+}
+
+/* [Description]: function responsible for starting to open the locked door
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_unlockDoor(void)
+{
+	g_closeAttempts=0;
+	/* start the motor before sending the state so the door does not wait for the UART */
+	CONTROL_startDoorMotion(DCMOTOR_CW , DOORPOS_OPEN);
+	if(g_unlockMeasured == TRUE)
+	{
+		LATENCY_record(&g_latency[LATENCY_MOTOR] , CONTROL_getTime() - g_pinEndTime);
+	}
+	CONTROL_sendDoorState(DOOR_UNLOCKING);
+}
+
+/* [Description]: function responsible for holding the door open for DOOR_HOLD_SECONDS
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_holdDoor(void)
+{
+	CONTROL_setHold(DOOR_HOLD_SECONDS);
+	CONTROL_sendDoorState(DOOR_OPEN);
+}
+
+/* [Description]: function responsible for keeping the door open for DOOR_EXTEND_HOLD_SECONDS when the HMI ECU
+ * 				  asks for it
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_extendHold(void)
+{
+	CONTROL_setHold(DOOR_EXTEND_HOLD_SECONDS);
+	CONTROL_sendDoorState(DOOR_OPEN);
+}
+
+/* [Description]: function responsible for starting to close the door when the hold is over
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_closeDoor(void)
+{
+	CONTROL_sendDoorState(DOOR_LOCKING);
+	CONTROL_startDoorMotion(DCMOTOR_ACW , DOORPOS_CLOSED);
+}
+
+/* [Description]: function responsible for stopping the door while it is locking and opening it again
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_reopenDoor(void)
+{
+	DCMOTOR_stop();
+	CONTROL_endDoorMotion();
+	CONTROL_sendDoorState(DOOR_UNLOCKING);
+	CONTROL_startDoorMotion(DCMOTOR_CW , DOORPOS_OPEN);
+}
+
+/* [Description]: function responsible for opening the door again when something blocks it while it is locking
+ * 				  and counting the attempts of closing it
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_retryClose(void)
+{
+	g_closeAttempts++;
+	LOG1(LOG_CLOSE_RETRY , g_closeAttempts);
+	CONTROL_sendDoorState(DOOR_UNLOCKING);
+	CONTROL_startDoorMotion(DCMOTOR_CW , DOORPOS_OPEN);
+}
+
+/* [Description]: function responsible for leaving the door where the emergency stop stopped it
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_stopDoor(void)
+{
+	/* the motor was stopped by the UART interrupt */
+	g_counters.emergencyStops++;
+	CONTROL_endDoorMotion();
+	CONTROL_setHold(0);
+	CONTROL_sendDoorState(DOOR_FAULT);
+}
+
+/* [Description]: function responsible for giving the events of the door to the state machine when the motion
+ * 				  is over or an emergency stop was requested , it is called by the main loop and it never
+ * 				  waits so the requests are served while the door is moving
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_doorProcessing(void)
+{
+	/* variable to hold the state of the door */
+	uint8 state = FSM_getState(&g_controlFsm);
+	/* the motor is read before the stop request , the interrupt stops the motor and latches the request
+	 * together so a motor stopped by it is always seen with its request */
+	bool moving = DCMOTOR_isMoving();
+	bool stop;
+	/* the door arrived at the closed end while it is locking */
+	bool arrived;
+	uint8 sreg = SREG;
+	cli();
+	stop = g_stopRequested;
+	g_stopRequested = FALSE;
+	SREG = sreg;
+	if(stop == TRUE)
+	{
+		FSM_dispatch(&g_controlFsm , EVENT_EMERGENCY_STOP);
+	}
+	else if((state == DOOR_UNLOCKING) && (moving == FALSE))
+	{
+		/* the door is open , or held where the motor stalled */
+		CONTROL_endDoorMotion();
+		if(g_closeAttempts < DOOR_CLOSE_ATTEMPTS)
+		{
+			FSM_dispatch(&g_controlFsm , EVENT_MOTION_DONE);
+		}
+		else
+		{
+			/* the door could not be closed so it is left open */
+			g_counters.closeFailures++;
+			FSM_dispatch(&g_controlFsm , EVENT_CLOSE_FAILED);
+		}
+	}
+	else if((state == DOOR_LOCKING) && (moving == FALSE))
+	{
+		arrived = CONTROL_endDoorMotion();
+		if((arrived == FALSE) && (DOORPOS_getPosition() == DOORPOS_CLOSED))
+		{
+			/* the motor stalled against the frame , the door is closed */
+			arrived = TRUE;
+		}
+#if (DOORPOS_USE_CLOSED_SWITCH == 0)
+		if((arrived == FALSE) && (g_stalledAtEnd == TRUE))
+		{
+			/* without the closed switch the end of the travel is only seen as a stall at the end of the profile */
+			arrived = TRUE;
+		}
+#endif
+		if(arrived == TRUE)
+		{
+			FSM_dispatch(&g_controlFsm , EVENT_MOTION_DONE);
+		}
+		else
+		{
+			/* something blocks the door so open it again */
+			FSM_dispatch(&g_controlFsm , EVENT_MOTION_STALLED);
+		}
+	}
+}
+
+/* [Description]: function called every second of the tick for the lockout , it counts down the seconds left
+ * 				  and when the lockout is over it stops the buzzer
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_timerLockoutProcessing(void)
+{
+	if(g_lockoutSeconds > 0)
+	{
+		g_lockoutSeconds--;
+		if(g_lockoutSeconds == 0)
+		{
+			/* the lockout is over so turn off the buzzer */
+			CONTROL_buzzerOff();
+		}
+	}
+}
+
+/* [Description]: the call back function for the interrupt of Timer Module , it is called every tick
+ * 				  it steps the buzzer and the motor , counts down the hold of the door and queues EVENT_HOLD_OVER
+ * 				  at its end and calls the lockout processing and the per second call back every second
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_tickProcessing(void)
+{
+	BUZZER_tick(); /* play the next step of the buzzer pattern */
+	DCMOTOR_tick(); /* drive the speed profile of the door motor */
+	g_ticks++;
+	if(g_holdTicks > 0)
+	{
+		g_holdTicks--; /* the door is held open */
+		if(g_holdTicks == 0)
+		{
+			QUEUE_put(&g_eventQueue , EVENT_HOLD_OVER);
+		}
+	}
+	g_ticksOfSecond++;
+	if(g_ticksOfSecond == TICKS_PER_SECOND)
+	{
+		g_ticksOfSecond=0;
+		CONTROL_timerLockoutProcessing();
+		if(g_secondCallBackPtr != NULL)
+		{
+			(*g_secondCallBackPtr)();
+		}
+	}
+}
+
+/* [Description]: function responsible for setting the function called by the tick every second
+ * [Arguments]: the address of the function or NULL to stop calling it
+ * [Returns]: no return
+ */
+void CONTROL_setSecondCallBack(void(*a_ptr)(void))
+{
+	g_ticksOfSecond=0;
+	g_secondCallBackPtr = a_ptr;
+}
+
+/* [Description]: function responsible for indicating if two arrays are equal or not
+ * [Arguments]: it takes two arrays addresses and the size of the array
+ * [Returns]: return 1 if the two arrays are equal
+ * 			  return 0 if the two arrays are different
+ */
+uint8 CONTROL_compare(uint8 *a_first , uint8 *a_second , uint8 a_arraySize)
+{
+	/* incremental variable for the for loop */
+	uint8 i=0;
+	uint8 equal=1;
+	PROBE_ENTER(PROBE_COMPARE);
+	for(i=0;i<a_arraySize;i++)
+	{
+		/* condition to compare each elements of the two arrays */
+		if(a_first[i] != a_second[i])
+		{
+			equal=0;
+			break;
+		}
+	}
+	PROBE_EXIT(PROBE_COMPARE);
+	return equal;
+}
+
+/* [Description]: function responsible for reading the password record from the external EEPROM to RAM , the
+ * 				  record is read once when the system starts and kept in RAM while it matches the EEPROM
+ * 				  so a session never waits for the I2C
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_loadRecord(void)
+{
+	uint32 start = CONTROL_getTime();
+	g_recordLoaded = (EEPROM_readArray(PASSWORD_ADDRESS , g_passwordRecord , PASSWORD_RECORD_SIZE) == SUCCESS);
+	LATENCY_addToHistogram(&g_histograms[HISTOGRAM_EEPROM] , CONTROL_getTime() - start);
+}
+
+/* [Description]: function responsible for taking the real password record when a session of checking a
+ * 				  password is opened , the digits received before are compared at once and the next digits
+ * 				  are compared by the UART interrupt when they are received
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_prefetchRecord(void)
+{
+	/* the record : the number of digits followed by the digits */
+	uint8 length;
+	uint8 *password = &g_passwordRecord[1];
+	uint8 i;
+	uint32 start = CONTROL_getTime();
+	if(g_recordLoaded == FALSE)
+	{
+		/* the record in RAM is not valid (the last access of the EEPROM failed) so read it again */
+		CONTROL_loadRecord();
+	}
+	length = g_passwordRecord[0];
+	if((g_recordLoaded == FALSE) || (length < PIN_MIN_LENGTH) || (length > PIN_MAX_LENGTH))
+	{
+		/* there is no valid password record so every password is wrong */
+		length = 0;
+	}
+	LATENCY_record(&g_latency[LATENCY_PREFETCH] , CONTROL_getTime() - start);
+	/* the UART interrupt compares the digits from now on */
+	cli();
+	real_length = length;
+	for(i=0;i<length;i++)
+	{
+		real_password[i] = password[i];
+	}
+	g_digitMismatch = (length == 0);
+	for(i=0;i<received_length;i++)
+	{
+		if((i >= length) || (received_password[i] != password[i]))
+		{
+			g_digitMismatch = TRUE;
+		}
+	}
+	g_recordReady = TRUE;
+	sei();
+}
+
+/* [Description]: function responsible for giving the result of comparing the received password with the
+ * 				  real password , the digits are already compared so only the length is checked
+ * [Arguments]: no arguments
+ * [Returns]: return 1 if the received password is right
+ * 			  return 0 if it is wrong
+ */
+uint8 CONTROL_checkPassword(void)
+{
+	uint8 right;
+	if(g_recordReady == FALSE)
+	{
+		/* the session was not opened , the real password is read now */
+		CONTROL_prefetchRecord();
+	}
+	cli();
+	/* an empty or short password is never right even if the real password record is not valid */
+	right = ((g_digitMismatch == FALSE) && (received_length == real_length) &&
+			(real_length >= PIN_MIN_LENGTH) && (received_length >= PIN_MIN_LENGTH));
+	g_recordReady = FALSE;
+	sei();
+	LATENCY_record(&g_latency[LATENCY_VERDICT] , CONTROL_getTime() - g_pinEndTime);
+	LATENCY_addToHistogram(&g_histograms[HISTOGRAM_VERIFY] , CONTROL_getTime() - g_pinEndTime);
+	return right;
+}
+
+/* [Description]: function responsible for locking the system and turning on the Buzzer , the lockout is counted
+ * 				  down by the tick so the CONTROL ECU keeps serving the HMI ECU while it is locked
+ * 				  every lockout without a right password in between lasts double the previous one
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_startLockout(void)
+{
+	uint16 seconds = LOCKOUT_BASE_SECONDS << g_lockoutCount;
+	if(g_lockoutCount < LOCKOUT_MAX_DOUBLINGS)
+	{
+		g_lockoutCount++;
+	}
+	g_counters.lockouts++;
+	LOG2(LOG_LOCKOUT , seconds);
+	BUZZER_play(BUZZER_ALARM);  /* the alarm is played until the lockout is over */
+	cli();
+	g_lockoutSeconds = seconds;
+	sei();
+	/* tell the HMI ECU for how long the system is locked */
+	CONTROL_sendStatus();
+}
+
+/* [Description]: function responsible for turning the buzzer off
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_buzzerOff(void)
+{
+	BUZZER_stop(); /* turn off the buzzer */
+}
+
+/* [Description]: function responsible for counting a wrong password and locking the system
+ * 				  when the password is entered wrong for WRONG_PASSWORD_LIMIT times
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_wrongPassword(void)
+{
+	/* increment the wrong counter */
+	wrong_counter++;
+	g_counters.wrongPasswords++;
+	LOG1(LOG_WRONG_PASSWORD , wrong_counter);
+	if(wrong_counter == WRONG_PASSWORD_LIMIT)
+	{
+		/* if the entered password is wrong for 3 times lock the system */
+		wrong_counter=0;
+		CONTROL_startLockout();
+	}
+}
+
+/* [Description]: function responsible for sending a new state of the door to the HMI ECU , it is the first reply
+ * 				  of OPEN_DOOR (EVENT_UNLOCK is dispatched before the result) so it ends the turnaround too
+ * [Arguments]: the state of the door (DOOR_UNLOCKING , DOOR_OPEN , DOOR_LOCKING , DOOR_LOCKED or DOOR_FAULT)
+ * [Returns]: no return
+ */
+void CONTROL_sendDoorState(uint8 a_state)
+{
+	CONTROL_sendReply(DOOR_STATE);
+	UART_sendByte(a_state);
+	LOG1(LOG_DOOR_STATE , a_state);
+}
+
+/* [Description]: function responsible for sending the probes of the hot paths for the offline analysis
+ * 				  PROBE_DUMP followed by the number of probes and 3 bytes for every probe from the oldest :
+ * 				  the id , the high byte and the low byte of the counter of Timer 1
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_dumpProbes(void)
+{
+	Probe_RecordType probes[PROBE_SIZE];
+	uint8 count = PROBE_getRecords(probes);
+	uint8 i;
+	UART_sendByte(PROBE_DUMP);
+	UART_sendByte(count);
+	for(i=0;i<count;i++)
+	{
+		UART_sendByte(probes[i].id);
+		UART_sendByte(probes[i].time >> 8);
+		UART_sendByte(probes[i].time & 0xFF);
+	}
+}
+
+/* [Description]: function responsible for sending the first byte of a reply , the time from the last byte of
+ * 				  the request to the first byte sent is counted in the turnaround histogram once for every request
+ * [Arguments]: the first byte of the reply
+ * [Returns]: no return
+ */
+static void CONTROL_sendReply(uint8 a_reply)
+{
+	uint32 requestTime;
+	bool pending;
+	uint8 sreg = SREG;
+	cli();
+	requestTime = g_requestTime;
+	pending = g_replyPending;
+	g_replyPending = FALSE;
+	SREG = sreg;
+	if(pending == TRUE)
+	{
+		LATENCY_addToHistogram(&g_histograms[HISTOGRAM_TURNAROUND] , CONTROL_getTime() - requestTime);
+	}
+	UART_sendByte(a_reply);
+}
+
+/* [Description]: function responsible for sending the histograms of the times , the counters of the use of the
+ * 				  door and the receive errors of the UART in one frame : DIAGNOSTICS , the length of the data , the
+ * 				  buckets of every histogram , the counters and the errors (every one high byte first) and the XOR
+ * 				  of the data
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_sendDiagnostics(void)
+{
+	uint8 histogram;
+	uint8 bucket;
+	uint16 count;
+	uint8 checksum = 0;
+	uint8 sreg;
+	Uart_ErrorsType errors;
+	UART_getErrors(&errors);
+	UART_sendByte(DIAGNOSTICS);
+	UART_sendByte((HISTOGRAMS * LATENCY_BUCKETS * 2) + sizeof(Control_CountersType) + sizeof(Uart_ErrorsType));
+	for(histogram=0;histogram<HISTOGRAMS;histogram++)
+	{
+		for(bucket=0;bucket<LATENCY_BUCKETS;bucket++)
+		{
+			/* the histogram of the UART interrupt is changed by the interrupt */
+			sreg = SREG;
+			cli();
+			count = g_histograms[histogram].s_buckets[bucket];
+			SREG = sreg;
+			CONTROL_sendWord(count , &checksum);
+		}
+	}
+	/* the counters are only changed by the main loop */
+	CONTROL_sendWord(g_counters.unlocks , &checksum);
+	CONTROL_sendWord(g_counters.wrongPasswords , &checksum);
+	CONTROL_sendWord(g_counters.lockouts , &checksum);
+	CONTROL_sendWord(g_counters.emergencyStops , &checksum);
+	CONTROL_sendWord(g_counters.closeFailures , &checksum);
+	CONTROL_sendWord(errors.frameErrors , &checksum);
+	CONTROL_sendWord(errors.parityErrors , &checksum);
+	CONTROL_sendWord(errors.overruns , &checksum);
+	UART_sendByte(checksum);
+}
+
+/* [Description]: function responsible for sending a 16-bit value of the diagnostics (high byte first) and adding
+ * 				  its bytes to the checksum of the frame
+ * [Arguments]: the value and the address of the checksum
+ * [Returns]: no return
+ */
+static void CONTROL_sendWord(uint16 a_word , uint8 *a_checksum_Ptr)
+{
+	UART_sendByte(a_word >> 8);
+	UART_sendByte(a_word & 0xFF);
+	*a_checksum_Ptr ^= (a_word >> 8) ^ (a_word & 0xFF);
+}
+
+/* [Description]: function responsible for sending the status of the system to the HMI ECU
+ * 				  SYSTEM_LOCKED followed by the seconds left (high byte first) or SYSTEM_READY
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_sendStatus(void)
+{
+	uint16 seconds = CONTROL_getLockoutSeconds();
+	if(seconds > 0)
+	{
+		CONTROL_sendReply(SYSTEM_LOCKED);
+		UART_sendByte(seconds >> 8);
+		UART_sendByte(seconds & 0xFF);
+	}
+	else
+	{
+		CONTROL_sendReply(SYSTEM_READY);
+	}
+}
+
+/* [Description]: function responsible for reading the seconds left of the lockout , they are changed by the tick
+ * 				  so they are read with the interrupts disabled
+ * [Arguments]: no arguments
+ * [Returns]: the seconds left , 0 when the system is not locked
+ */
+uint16 CONTROL_getLockoutSeconds(void)
+{
+	uint16 seconds;
+	cli();
+	seconds = g_lockoutSeconds;
+	sei();
+	return seconds;
+}
+
+/* [Description]: function responsible for comparing the received password from the HMI ECU with the real password
+ * 				  if it is equal give EVENT_UNLOCK to the state machine to start the open door cycle
+ * 				  then send to the HMI ECU that password is right
+ * 				  if its wrong send to the HMI ECU that password is wrong and count the wrong password
+ * 				  while the system is locked the status is sent instead of checking the password
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_openDoor(void)
+{
+	/* variable to hold the result of comparision */
+	uint8 temp;
+	/* variable to hold the time the reply started to be sent */
+	uint32 start;
+	if(CONTROL_getLockoutSeconds() > 0)
+	{
+		/* the password is not checked while the system is locked */
+		CONTROL_sendStatus();
+		return;
+	}
+	/* compare between the entered password and the real one  ,and store the result in temp variable */
+	temp= CONTROL_checkPassword();
+	if(temp == 1)
+	{
+		/* start the door first , the cycle is driven by the main loop */
+		g_counters.unlocks++;
+		g_unlockMeasured=TRUE;
+		FSM_dispatch(&g_controlFsm , EVENT_UNLOCK);
+		g_unlockMeasured=FALSE;
+		/* send to the HMI ECU that the entered password is right */
+		start = CONTROL_getTime();
+		CONTROL_sendReply(PASSWORD_IS_RIGHT);
+		LATENCY_record(&g_latency[LATENCY_REPLY] , CONTROL_getTime() - start);
+		BUZZER_play(BUZZER_SUCCESS);
+		wrong_counter=0;
+		g_lockoutCount=0;
+	}
+	else if(temp == 0)
+	{
+		/* if the entered password does not match with the real password send to the HMI ECU  that password is wrong*/
+		start = CONTROL_getTime();
+		CONTROL_sendReply(PASSWORD_IS_WRONG);
+		LATENCY_record(&g_latency[LATENCY_REPLY] , CONTROL_getTime() - start);
+		CONTROL_wrongPassword();
+	}
+}
+
+/* [Description]: function responsible for comparing the received password with the real password
+ * 				  if it is right send to the HMI ECU to precede change
+ * 				  and if it is wrong send to the HMI ECU not to change and count the wrong password
+ * 				  while the system is locked the status is sent instead of checking the password
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_changePassword(void)
+{
+	/* variable to hold the result of comparision */
+	uint8 temp;
+	if(CONTROL_getLockoutSeconds() > 0)
+	{
+		/* the password is not checked while the system is locked */
+		CONTROL_sendStatus();
+		return;
+	}
+	/* compare between the entered password and the real one  ,and store the result in temp variable */
+	temp= CONTROL_checkPassword();
+	if(temp == 1)
+	{
+		/* if the entered password matches the real password send to the HMI ECU to precede change */
+		CONTROL_sendReply(PRECEDE_CHANGE);
+		BUZZER_play(BUZZER_SUCCESS);
+		wrong_counter=0;
+		g_lockoutCount=0;
+	}
+	else if(temp == 0)
+	{
+		/* if the entered password does not matches the real password send to the HMI ECU to dont change*/
+		CONTROL_sendReply(DONT_CHANGE);
+		CONTROL_wrongPassword();
+	}
+}
+
+/* [Description]: function responsible for writing the received password record to the external EEPROM and
+ * 				  to the record kept in RAM , the EEPROM is not written when the record is not changed
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void CONTROL_setPassword(void)
+{
+	/* the record to be written : the number of digits followed by the digits */
+	uint8 record[PASSWORD_RECORD_SIZE];
+	uint8 i;
+	uint8 written;
+	uint32 start;
+	if(received_length < PIN_MIN_LENGTH)
+	{
+		/* the HMI ECU never sends a shorter password so do not overwrite the saved one */
+		return;
+	}
+	record[0] = received_length;
+	for(i=0;i<received_length;i++)
+	{
+		record[i+1] = received_password[i];
+	}
+	if((g_recordLoaded == TRUE) && (CONTROL_compare(record , g_passwordRecord , received_length + 1) == 1))
+	{
+		/* the same password is saved already so save a write cycle of the EEPROM */
+		return;
+	}
+	/* write the new password to the external EEPROM */
+	start = CONTROL_getTime();
+	written = EEPROM_writeArray(PASSWORD_ADDRESS , record , received_length + 1);
+	LATENCY_addToHistogram(&g_histograms[HISTOGRAM_EEPROM] , CONTROL_getTime() - start);
+	if(written == SUCCESS)
+	{
+		for(i=0;i<=received_length;i++)
+		{
+			g_passwordRecord[i] = record[i];
+		}
+	}
+	else
+	{
+		/* the EEPROM may hold part of the record so read it again before the next session */
+		g_recordLoaded = FALSE;
+		LOG0(LOG_EEPROM_FAILED);
+	}
+}
+
+
@@ -0,0 +1,130 @@
+  /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Motor Current
+ *
+ * [File Name]:current.c
+ *
+ * [Description]: source file for the Motor Current service
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+#include"current.h"
+
+/* the address of the function called when the motor stalls */
+static void (*volatile g_callBackPtr) (void)=NULL;
+/* the filtered current in ADC counts scaled by 2^CURRENT_FILTER_SHIFT */
+static volatile uint16 g_filtered = 0;
+/* TRUE while a motion is watched */
+static volatile bool g_watching = FALSE;
+/* samples left of the start current and samples in a row above the threshold */
+static volatile uint16 g_blankingSamples = 0;
+static volatile uint8 g_highSamples = 0;
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: CURRENT_init
+ * [Description]:   function responsible for starting the ADC on the shunt resistor , every sample is given to
+ * 					CURRENT_processSample from the ADC interrupt
+ * [Args]: void
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void CURRENT_init(void)
+{
+	Adc_ConfigType Adc_Config={AVCC,CURRENT_ADC_CLOCK,CURRENT_TRIGGER,CURRENT_CHANNEL};
+	ADC_setCallBack(CURRENT_processSample);
+	ADC_init(&Adc_Config);
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: CURRENT_setCallBack
+ * [Description]:   function responsible for setting the function called from the ADC interrupt when the motor stalls
+ * [Args]: the address of the function
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void CURRENT_setCallBack(void(*a_ptr)(void))
+{
+	g_callBackPtr = a_ptr;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: CURRENT_start
+ * [Description]:   function responsible for watching a new motion , it should be called when the motor is started
+ * 					so the start current is not taken as a stall
+ * [Args]: void
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void CURRENT_start(void)
+{
+	uint8 sreg = SREG; /* the state is also changed by the ADC interrupt */
+	cli();
+	g_blankingSamples = CURRENT_BLANKING_SAMPLES;
+	g_highSamples = 0;
+	g_watching = TRUE;
+	SREG = sreg;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: CURRENT_stop
+ * [Description]:   function responsible for stopping the stall detection when the motor is stopped
+ * [Args]: void
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void CURRENT_stop(void)
+{
+	g_watching = FALSE;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: CURRENT_processSample
+ * [Description]:   function responsible for filtering one sample and reporting a stall once when the filtered
+ * 					current stays above the threshold , it is called from the ADC interrupt and it can be
+ * 					called with recorded samples to check the thresholds
+ * [Args]: uint16 a_sample : the sample in ADC counts
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void CURRENT_processSample(uint16 a_sample)
+{
+	/* the filter is kept scaled by 2^CURRENT_FILTER_SHIFT so no fraction is lost */
+	g_filtered = g_filtered - (g_filtered >> CURRENT_FILTER_SHIFT) + a_sample;
+	if(g_watching == FALSE)
+	{
+		return;
+	}
+	if(g_blankingSamples > 0)
+	{
+		g_blankingSamples--;
+		return;
+	}
+	if((g_filtered >> CURRENT_FILTER_SHIFT) > CURRENT_STALL_THRESHOLD)
+	{
+		g_highSamples++;
+		if(g_highSamples >= CURRENT_STALL_SAMPLES)
+		{
+			g_watching = FALSE; /* the stall is reported once */
+			if(g_callBackPtr != NULL)
+			{
+				(*g_callBackPtr)();
+			}
+		}
+	}
+	else
+	{
+		g_highSamples = 0;
+	}
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: CURRENT_getFiltered
+ * [Description]:   function responsible for reading the filtered current
+ * [Args]: void
+ * [Returns]: uint16 : the filtered current in ADC counts
+ -----------------------------------------------------------------------------------------------------------------------------*/
+uint16 CURRENT_getFiltered(void)
+{
+	uint16 filtered;
+	uint8 sreg = SREG; /* the filter is changed by the ADC interrupt */
+	cli();
+	filtered = g_filtered;
+	SREG = sreg;
+	return (filtered >> CURRENT_FILTER_SHIFT);
+}
@@ -0,0 +1,44 @@
+ /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Motor Current
+ *
+ * [File Name]: current.h
+ *
+ * [Description]: header file for the Motor Current service , it samples the voltage of the shunt resistor of the
+ * 				  L293D with the ADC , filters it and reports a stall of the motor when the current stays high
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef CURRENT_H_
+#define CURRENT_H_
+
+#include"common_macros.h"
+#include"micro_config.h"
+#include"std_types.h"
+#include"adc.h"
+
+/* the shunt resistor is on ADC0 (PA0) , the samples are taken at every overflow of the PWM of Timer 0
+ * (about 3.9 KHz) so they are taken at the same point of the PWM cycle , the ADC clock is F_CPU/64 */
+#define CURRENT_CHANNEL 0
+#define CURRENT_TRIGGER TIMER0_OVERFLOW
+#define CURRENT_ADC_CLOCK ADC_F_CPU_64
+
+/* the filter is y = y + (x - y) / 2^CURRENT_FILTER_SHIFT , about 2 ms at 3.9 KHz */
+#define CURRENT_FILTER_SHIFT 3
+/* a stall is reported when the filtered current is above CURRENT_STALL_THRESHOLD (ADC counts , about 0.6 A
+ * with a 0.5 ohm shunt and AVCC of 5 V) for CURRENT_STALL_SAMPLES samples in a row */
+#define CURRENT_STALL_THRESHOLD 61
+#define CURRENT_STALL_SAMPLES 8
+/* the samples of the start current of the motor are not checked , about 250 ms */
+#define CURRENT_BLANKING_SAMPLES 1000
+
+void CURRENT_init(void);                          /* function prototype for starting the sampling */
+void CURRENT_setCallBack(void(*a_ptr)(void));     /* function prototype for setting the stall call back */
+void CURRENT_start(void);                         /* function prototype for watching a new motion */
+void CURRENT_stop(void);                          /* function prototype for stopping the stall detection */
+void CURRENT_processSample(uint16 a_sample);      /* function prototype for processing one sample */
+uint16 CURRENT_getFiltered(void);                 /* function prototype for reading the filtered current */
+
+#endif /* CURRENT_H_ */
@@ -1,57 +1,211 @@
-  /*----------------------------------------------------------------------------------------------------------------------------
- *
- * [Module]: DC Motor
- *
- * [File Name]:dcmotor.c
- *
- * [Description]: source file for DC Motor Driver
- *
- * [Author]:  Shady Ali
- *
-------------------------------------------------------------------------------------------------------------------------------*/
-#include"dcmotor.h"
-
-/*------------------------------------------------------------------------------------------------------------------------------
- * [Function Name]: DCMOTOR_cw
- * [Description]:   function responsible for intializing DC Motor to rotate in clock wise
- * [Args]: void
- * [Returns]: void
- -----------------------------------------------------------------------------------------------------------------------------*/
-
-void DCMOTOR_cw(void){
-	INPUT_PORT_DIR|=(1<<INPUT1)|(1<<INPUT2);    /* intializing input1 and input2 as output pins*/
-	INPUT_PORT &=(~(1<<INPUT1))&(~(1<<INPUT2)); /* intializing input1 and input2 pins to zero */
-	/* in order to rotate the motor in clock wise we need to assign input1 to 0
-	 * and input2 to 1*/
-	CLEAR_BIT(INPUT_PORT,INPUT1);  /*assign input1 to 0 */
-	SET_BIT(INPUT_PORT,INPUT2);   /* assign input2 to 1 */
-}
-
-/*------------------------------------------------------------------------------------------------------------------------------
- * [Function Name]: DCMOTOR_acw
- * [Description]:   function responsible for intializing DC Motor to rotate in anti clock wise
- * [Args]: void
- * [Returns]: void
- -----------------------------------------------------------------------------------------------------------------------------*/
-
-void DCMOTOR_acw(void){
-	INPUT_PORT_DIR|=(1<<INPUT1)|(1<<INPUT2);    /* intializing input1 and input2 as output pins*/
-	INPUT_PORT &=(~(1<<INPUT1))&(~(1<<INPUT2)); /* intializing input1 and input2 pins to zero */
-	/* in order to rotate the motor in anti clock wise we need to assign input1 to 1
-	 * and input2 to 0       */
-	SET_BIT(INPUT_PORT,INPUT1);    /* assign input1 to 1 */
-	CLEAR_BIT(INPUT_PORT,INPUT2);  /* assign input2 to 0 */
-}
-
-/*------------------------------------------------------------------------------------------------------------------------------
- * [Function Name]: DCMOTOR_stop
- * [Description]:   function responsible for stopping the motor from rotating
- * [Args]: void
- * [Returns]: void
- -----------------------------------------------------------------------------------------------------------------------------*/
-
-void DCMOTOR_stop(void){
-	/* to stop the motor input1 and input2 have to be 0  */
-	INPUT_PORT &=(~(1<<INPUT1))&(~(1<<INPUT2));   /* assign input1 and input2 to 0  */
-}
-
+  /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: DC Motor
+ *
+ * [File Name]:dcmotor.c
+ *
+ * [Description]: source file for DC Motor Driver
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+#include"dcmotor.h"
+#include"trace.h"
+
+/*
+ * Description: enumeration of the phases of a motion
+ */
+typedef enum
+{
+	DCMOTOR_IDLE , DCMOTOR_ACCELERATING , DCMOTOR_CRUISING , DCMOTOR_DECELERATING
+}DcMotor_Phase;
+
+/* the profile of the running motion , its phase and the ticks passed in the phase */
+static const DcMotor_ProfileType *g_profile_Ptr = NULL;
+static volatile DcMotor_Phase g_phase = DCMOTOR_IDLE;
+static volatile uint16 g_phaseTicks = 0;
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: DCMOTOR_rampDuty
+ * [Description]:   function responsible for calculating the duty cycle after a_ticks of a ramp of a_rampTicks
+ * 					that goes from a_fromDuty to a_toDuty
+ * [Args]: uint8 a_fromDuty , uint8 a_toDuty , uint16 a_ticks , uint16 a_rampTicks
+ * [Returns]: uint8
+ -----------------------------------------------------------------------------------------------------------------------------*/
+static uint8 DCMOTOR_rampDuty(uint8 a_fromDuty , uint8 a_toDuty , uint16 a_ticks , uint16 a_rampTicks)
+{
+	sint32 difference = (sint32)a_toDuty - (sint32)a_fromDuty;
+	return (uint8)((sint32)a_fromDuty + ((difference * (sint32)a_ticks) / (sint32)a_rampTicks));
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: DCMOTOR_init
+ * [Description]:   function responsible for initializing Timer 0 in fast PWM mode on OC0 (the enable pin)
+ * 					and keeping the motor stopped
+ * [Args]: void
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+
+void DCMOTOR_init(void){
+	/* fast PWM , non inverting on OC0 , F_CPU/8 gives a PWM frequency of about 3.9 KHz */
+	Timer_ConfigType Timer_Config={timer0,FAST_PWM,F_CPU_8,CLEAR,NOT_USING2,0,0,0};
+	INPUT_PORT_DIR|=(1<<INPUT1)|(1<<INPUT2);    /* intializing input1 and input2 as output pins*/
+	DCMOTOR_stop();
+	TIMER_init(&Timer_Config);
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: DCMOTOR_move
+ * [Description]:   function responsible for starting a motion with a speed profile , the function returns
+ * 					immediately and the motion is driven by DCMOTOR_tick
+ * [Args]: DcMotor_Direction a_direction , const DcMotor_ProfileType *a_profile_Ptr
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+
+void DCMOTOR_move(DcMotor_Direction a_direction , const DcMotor_ProfileType *a_profile_Ptr){
+	uint8 sreg = SREG; /* the motion is also driven by the tick */
+	cli();
+	g_profile_Ptr = a_profile_Ptr;
+	g_phaseTicks = 0;
+	g_phase = DCMOTOR_ACCELERATING;
+	TIMER_setCompareValue(timer0,a_profile_Ptr->s_startDuty);
+	TRACE_SIGNAL(TRACE_MOTOR,a_profile_Ptr->s_startDuty);
+	if(a_direction == DCMOTOR_CW)
+	{
+		CLEAR_BIT(INPUT_PORT,INPUT1);  /*assign input1 to 0 */
+		SET_BIT(INPUT_PORT,INPUT2);   /* assign input2 to 1 */
+	}
+	else
+	{
+		SET_BIT(INPUT_PORT,INPUT1);    /* assign input1 to 1 */
+		CLEAR_BIT(INPUT_PORT,INPUT2);  /* assign input2 to 0 */
+	}
+	SREG = sreg;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: DCMOTOR_tick
+ * [Description]:   function responsible for updating the duty cycle of the running motion and moving it to
+ * 					its next phase , it stops the motor at the end of the deceleration , it should be called every tick
+ * [Args]: void
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+
+void DCMOTOR_tick(void){
+	if(g_phase == DCMOTOR_IDLE)
+	{
+		return;
+	}
+	g_phaseTicks++;
+	if(g_phase == DCMOTOR_ACCELERATING)
+	{
+		if(g_phaseTicks >= g_profile_Ptr->s_accelerationTicks)
+		{
+			g_phase = DCMOTOR_CRUISING;
+			g_phaseTicks = 0;
+			TIMER_setCompareValue(timer0,g_profile_Ptr->s_cruiseDuty);
+			TRACE_SIGNAL(TRACE_MOTOR,g_profile_Ptr->s_cruiseDuty);
+		}
+		else
+		{
+			TIMER_setCompareValue(timer0,DCMOTOR_rampDuty(g_profile_Ptr->s_startDuty,g_profile_Ptr->s_cruiseDuty,
+					g_phaseTicks,g_profile_Ptr->s_accelerationTicks));
+		}
+	}
+	else if(g_phase == DCMOTOR_CRUISING)
+	{
+		if(g_phaseTicks >= g_profile_Ptr->s_cruiseTicks)
+		{
+			g_phase = DCMOTOR_DECELERATING;
+			g_phaseTicks = 0;
+		}
+	}
+	else if(g_phase == DCMOTOR_DECELERATING)
+	{
+		if(g_phaseTicks >= g_profile_Ptr->s_decelerationTicks)
+		{
+			DCMOTOR_stop(); /* the motion is over */
+		}
+		else
+		{
+			TIMER_setCompareValue(timer0,DCMOTOR_rampDuty(g_profile_Ptr->s_cruiseDuty,g_profile_Ptr->s_startDuty,
+					g_phaseTicks,g_profile_Ptr->s_decelerationTicks));
+		}
+	}
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: DCMOTOR_isMoving
+ * [Description]:   function responsible for checking if a motion started by DCMOTOR_move is still running
+ * [Args]: void
+ * [Returns]: bool
+ -----------------------------------------------------------------------------------------------------------------------------*/
+
+bool DCMOTOR_isMoving(void){
+	return (g_phase != DCMOTOR_IDLE);
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: DCMOTOR_isDecelerating
+ * [Description]:   function responsible for checking if the running motion is in its deceleration (the end of the travel)
+ * [Args]: void
+ * [Returns]: bool
+ -----------------------------------------------------------------------------------------------------------------------------*/
+
+bool DCMOTOR_isDecelerating(void){
+	return (g_phase == DCMOTOR_DECELERATING);
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: DCMOTOR_cw
+ * [Description]:   function responsible for intializing DC Motor to rotate in clock wise
+ * [Args]: void
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+
+void DCMOTOR_cw(void){
+	INPUT_PORT_DIR|=(1<<INPUT1)|(1<<INPUT2);    /* intializing input1 and input2 as output pins*/
+	INPUT_PORT &=(~(1<<INPUT1))&(~(1<<INPUT2)); /* intializing input1 and input2 pins to zero */
+	/* in order to rotate the motor in clock wise we need to assign input1 to 0
+	 * and input2 to 1*/
+	CLEAR_BIT(INPUT_PORT,INPUT1);  /*assign input1 to 0 */
+	SET_BIT(INPUT_PORT,INPUT2);   /* assign input2 to 1 */
+	g_phase = DCMOTOR_IDLE;       /* cancel any running motion */
+	TIMER_setCompareValue(timer0,DCMOTOR_FULL_DUTY);
+	TRACE_SIGNAL(TRACE_MOTOR,DCMOTOR_FULL_DUTY);
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: DCMOTOR_acw
+ * [Description]:   function responsible for intializing DC Motor to rotate in anti clock wise
+ * [Args]: void
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+
+void DCMOTOR_acw(void){
+	INPUT_PORT_DIR|=(1<<INPUT1)|(1<<INPUT2);    /* intializing input1 and input2 as output pins*/
+	INPUT_PORT &=(~(1<<INPUT1))&(~(1<<INPUT2)); /* intializing input1 and input2 pins to zero */
+	/* in order to rotate the motor in anti clock wise we need to assign input1 to 1
+	 * and input2 to 0       */
+	SET_BIT(INPUT_PORT,INPUT1);    /* assign input1 to 1 */
+	CLEAR_BIT(INPUT_PORT,INPUT2);  /* assign input2 to 0 */
+	g_phase = DCMOTOR_IDLE;        /* cancel any running motion */
+	TIMER_setCompareValue(timer0,DCMOTOR_FULL_DUTY);
+	TRACE_SIGNAL(TRACE_MOTOR,DCMOTOR_FULL_DUTY);
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: DCMOTOR_stop
+ * [Description]:   function responsible for stopping the motor from rotating
+ * [Args]: void
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+
+void DCMOTOR_stop(void){
+	/* to stop the motor input1 and input2 have to be 0  */
+	INPUT_PORT &=(~(1<<INPUT1))&(~(1<<INPUT2));   /* assign input1 and input2 to 0  */
+	g_phase = DCMOTOR_IDLE;                       /* cancel any running motion */
+	TIMER_setCompareValue(timer0,0);
+	TRACE_SIGNAL(TRACE_MOTOR,0);
+}
+
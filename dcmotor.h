@@ -1,32 +1,62 @@
- /*----------------------------------------------------------------------------------------------------------------------------
- *
- * [Module]: DC Motor
- *
- * [File Name]: dcmotor.h
- *
- * [Description]: header file for DC Motor driver
- *
- * [Author]:  Shady Ali
- *
-------------------------------------------------------------------------------------------------------------------------------*/
-
-#ifndef DCMOTOR_H_
-#define DCMOTOR_H_
-
-#include"common_macros.h"
-#include"micro_config.h"
-#include"std_types.h"
-
-#define ENABLE PB3    		       /* the enable pin */
-#define INPUT1 PB4  	 		  /* input1 pin */
-#define INPUT2 PB5   		     /* input2 pin */
-
-#define ENABLE_PORT PORTB       /* the port register of the enable pin */
-#define INPUT_PORT PORTB		/* the port register of input pins */
-#define INPUT_PORT_DIR DDRB     /* the port direction of input pins */
-
-void DCMOTOR_cw(void);		 /* function prototype for rotating the motor clock wise */
-void DCMOTOR_acw(void);      /* function prototype for rotating the motor anti clock wise */
-void DCMOTOR_stop(void);     /* function prototype for stopping the motor from rotating */
-
-#endif /* DCMOTOR_H_ */
+ /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: DC Motor
+ *
+ * [File Name]: dcmotor.h
+ *
+ * [Description]: header file for DC Motor driver
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef DCMOTOR_H_
+#define DCMOTOR_H_
+
+#include"common_macros.h"
+#include"micro_config.h"
+#include"std_types.h"
+#include"timer.h"
+
+#define ENABLE PB3    		       /* the enable pin */
+#define INPUT1 PB4  	 		  /* input1 pin */
+#define INPUT2 PB5   		     /* input2 pin */
+
+#define ENABLE_PORT PORTB       /* the port register of the enable pin */
+#define INPUT_PORT PORTB		/* the port register of input pins */
+#define INPUT_PORT_DIR DDRB     /* the port direction of input pins */
+
+#define DCMOTOR_FULL_DUTY 255   /* the duty cycle of the enable pin when the motor is fully on */
+
+/*
+ * Description: enumeration of the direction of a motion
+ */
+typedef enum
+{
+	DCMOTOR_CW , DCMOTOR_ACW
+}DcMotor_Direction;
+
+/*
+ * Description: structure of a trapezoidal speed profile , the duty cycle rises from the start duty to the cruise duty
+ * during the acceleration , stays at the cruise duty and falls back to the start duty during the deceleration
+ * then the motor is stopped , the times are counted in ticks of the caller
+ */
+typedef struct
+{
+	uint8 s_startDuty;				/* duty cycle (0 - 255) at the start and the end of the motion */
+	uint8 s_cruiseDuty;				/* duty cycle (0 - 255) in the middle of the motion */
+	uint16 s_accelerationTicks;		/* ticks of the acceleration */
+	uint16 s_cruiseTicks;			/* ticks at the cruise duty cycle */
+	uint16 s_decelerationTicks;		/* ticks of the deceleration */
+}DcMotor_ProfileType;
+
+void DCMOTOR_init(void);     /* function prototype for initializing the PWM of the enable pin */
+void DCMOTOR_move(DcMotor_Direction a_direction , const DcMotor_ProfileType *a_profile_Ptr); /* function prototype for starting a motion */
+void DCMOTOR_tick(void);     /* function prototype for driving the motion , called every tick */
+bool DCMOTOR_isMoving(void); /* function prototype for checking if a motion is running */
+bool DCMOTOR_isDecelerating(void); /* function prototype for checking if a motion is in its deceleration */
+void DCMOTOR_cw(void);		 /* function prototype for rotating the motor clock wise */
+void DCMOTOR_acw(void);      /* function prototype for rotating the motor anti clock wise */
+void DCMOTOR_stop(void);     /* function prototype for stopping the motor from rotating */
+
+#endif /* DCMOTOR_H_ */
@@ -0,0 +1,204 @@
+  /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Door Position
+ *
+ * [File Name]:doorpos.c
+ *
+ * [Description]: source file for the Door Position driver
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+#include"doorpos.h"
+#include"trace.h"
+
+/* the address of the function called when the door arrives at the armed end */
+static void (*volatile g_callBackPtr) (DoorPos_Position)=NULL;
+/* the end that the door is moving to or DOORPOS_BETWEEN if no arrival is expected */
+static volatile DoorPos_Position g_target = DOORPOS_BETWEEN;
+/* the position of the door in encoder counts from the closed end */
+static volatile sint16 g_count = 0;
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: DOORPOS_arrived
+ * [Description]:   function responsible for reporting the arrival of the door at a_position if it is the armed end
+ * 					it is called from the interrupts so the motor is stopped the instant the door arrives
+ * [Args]: DoorPos_Position a_position
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+static void DOORPOS_arrived(DoorPos_Position a_position)
+{
+	if(g_target != a_position)
+	{
+		return; /* bounces and arrivals at the other end are ignored */
+	}
+	g_target = DOORPOS_BETWEEN;
+	TRACE_SIGNAL(TRACE_DOOR_SWITCH,a_position);
+	if(g_callBackPtr != NULL)
+	{
+		(*g_callBackPtr)(a_position);
+	}
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [ISR Name]: INT1_vect
+ * [Description]:   the open end stop switch is pressed
+ -----------------------------------------------------------------------------------------------------------------------------*/
+ISR(INT1_vect)
+{
+	g_count = DOORPOS_TRAVEL_COUNTS; /* the switch corrects the drift of the encoder */
+	DOORPOS_arrived(DOORPOS_OPEN);
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [ISR Name]: INT2_vect
+ * [Description]:   the closed end stop switch is pressed
+ -----------------------------------------------------------------------------------------------------------------------------*/
+ISR(INT2_vect)
+{
+	g_count = 0;
+	DOORPOS_arrived(DOORPOS_CLOSED);
+}
+
+#if DOORPOS_USE_ENCODER
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [ISR Name]: INT0_vect
+ * [Description]:   channel A of the encoder changed , the door moves towards the open end when channel B
+ * 					differs from channel A after the change
+ -----------------------------------------------------------------------------------------------------------------------------*/
+ISR(INT0_vect)
+{
+	uint8 a = BIT_IS_SET(DOORPOS_ENCODER_PORT_IN,DOORPOS_ENCODER_A_PIN) ? 1 : 0;
+	uint8 b = BIT_IS_SET(DOORPOS_ENCODER_PORT_IN,DOORPOS_ENCODER_B_PIN) ? 1 : 0;
+	if(a != b)
+	{
+		g_count++;
+		if(g_count >= DOORPOS_TRAVEL_COUNTS)
+		{
+			DOORPOS_arrived(DOORPOS_OPEN);
+		}
+	}
+	else
+	{
+		g_count--;
+		if(g_count <= 0)
+		{
+			DOORPOS_arrived(DOORPOS_CLOSED);
+		}
+	}
+}
+#endif
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: DOORPOS_init
+ * [Description]:   function responsible for initializing the switch inputs with pull ups and their interrupts
+ * 					on the falling edge , and the encoder inputs and INT0 on any change if the encoder is used
+ * [Args]: void
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void DOORPOS_init(void)
+{
+	CLEAR_BIT(DOORPOS_OPEN_SWITCH_PORT_DIR,DOORPOS_OPEN_SWITCH_PIN);
+	SET_BIT(DOORPOS_OPEN_SWITCH_PORT_OUT,DOORPOS_OPEN_SWITCH_PIN);
+	CLEAR_BIT(DOORPOS_CLOSED_SWITCH_PORT_DIR,DOORPOS_CLOSED_SWITCH_PIN);
+	SET_BIT(DOORPOS_CLOSED_SWITCH_PORT_OUT,DOORPOS_CLOSED_SWITCH_PIN);
+	/* INT1 on the falling edge : ISC11=1 , ISC10=0 */
+	MCUCR = (MCUCR & 0xF3) | (1<<ISC11);
+	/* INT2 on the falling edge : ISC2=0 */
+	CLEAR_BIT(MCUCSR,ISC2);
+#if DOORPOS_USE_ENCODER
+	DOORPOS_ENCODER_PORT_DIR &= ~((1<<DOORPOS_ENCODER_A_PIN)|(1<<DOORPOS_ENCODER_B_PIN));
+	DOORPOS_ENCODER_PORT_OUT |= (1<<DOORPOS_ENCODER_A_PIN)|(1<<DOORPOS_ENCODER_B_PIN);
+	/* INT0 on any logical change : ISC01=0 , ISC00=1 */
+	MCUCR = (MCUCR & 0xFC) | (1<<ISC00);
+	SET_BIT(GIFR,INTF0);
+	SET_BIT(GICR,INT0);
+#endif
+	if(BIT_IS_CLEAR(DOORPOS_OPEN_SWITCH_PORT_IN,DOORPOS_OPEN_SWITCH_PIN))
+	{
+		g_count = DOORPOS_TRAVEL_COUNTS;
+	}
+	/* clear any old flags by writing one to them */
+	GIFR = (1<<INTF1)|(1<<INTF2);
+	GICR |= (1<<INT1)|(1<<INT2);
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: DOORPOS_setCallBack
+ * [Description]:   function responsible for setting the function called from the interrupt when the door arrives
+ * 					at the armed end
+ * [Args]: the address of the function
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void DOORPOS_setCallBack(void(*a_ptr)(DoorPos_Position))
+{
+	g_callBackPtr = a_ptr;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: DOORPOS_arm
+ * [Description]:   function responsible for waiting for the door to arrive at a_target , the arrival is reported
+ * 					once by the call back , it returns TRUE without arming if the door is already there
+ * 					or DOORPOS_BETWEEN disarms it
+ * [Args]: DoorPos_Position a_target
+ * [Returns]: bool
+ -----------------------------------------------------------------------------------------------------------------------------*/
+bool DOORPOS_arm(DoorPos_Position a_target)
+{
+	uint8 sreg = SREG; /* the target is also changed by the interrupts */
+	cli();
+	g_target = DOORPOS_BETWEEN;
+	if((a_target != DOORPOS_BETWEEN) && (DOORPOS_getPosition() == a_target))
+	{
+		SREG = sreg;
+		return TRUE;
+	}
+	g_target = a_target;
+	SREG = sreg;
+	return FALSE;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: DOORPOS_getPosition
+ * [Description]:   function responsible for reading the position of the door from the switches and the encoder
+ * [Args]: void
+ * [Returns]: DoorPos_Position
+ -----------------------------------------------------------------------------------------------------------------------------*/
+DoorPos_Position DOORPOS_getPosition(void)
+{
+	if(BIT_IS_CLEAR(DOORPOS_OPEN_SWITCH_PORT_IN,DOORPOS_OPEN_SWITCH_PIN))
+	{
+		return DOORPOS_OPEN;
+	}
+	if(BIT_IS_CLEAR(DOORPOS_CLOSED_SWITCH_PORT_IN,DOORPOS_CLOSED_SWITCH_PIN))
+	{
+		return DOORPOS_CLOSED;
+	}
+#if DOORPOS_USE_ENCODER
+	if(DOORPOS_getCount() >= DOORPOS_TRAVEL_COUNTS)
+	{
+		return DOORPOS_OPEN;
+	}
+	if(DOORPOS_getCount() <= 0)
+	{
+		return DOORPOS_CLOSED;
+	}
+#endif
+	return DOORPOS_BETWEEN;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: DOORPOS_getCount
+ * [Description]:   function responsible for reading the position of the door in encoder counts from the closed end
+ * [Args]: void
+ * [Returns]: sint16
+ -----------------------------------------------------------------------------------------------------------------------------*/
+sint16 DOORPOS_getCount(void)
+{
+	sint16 count;
+	uint8 sreg = SREG; /* the count is changed by the encoder interrupt */
+	cli();
+	count = g_count;
+	SREG = sreg;
+	return count;
+}
@@ -0,0 +1,61 @@
+ /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Door Position
+ *
+ * [File Name]: doorpos.h
+ *
+ * [Description]: header file for the Door Position driver , it watches the end stop switches of the door and
+ * 				  the optional quadrature encoder of the motor and reports the arrival of the door at an end
+ * 				  from the external interrupts
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef DOORPOS_H_
+#define DOORPOS_H_
+
+#include"common_macros.h"
+#include"micro_config.h"
+#include"std_types.h"
+
+/* the end stop switches are active low with the internal pull ups
+ * the open switch is on INT1 and the closed switch is on INT2 */
+#define DOORPOS_OPEN_SWITCH_PIN PD3
+#define DOORPOS_OPEN_SWITCH_PORT_IN PIND
+#define DOORPOS_OPEN_SWITCH_PORT_OUT PORTD
+#define DOORPOS_OPEN_SWITCH_PORT_DIR DDRD
+#define DOORPOS_CLOSED_SWITCH_PIN PB2
+#define DOORPOS_CLOSED_SWITCH_PORT_IN PINB
+#define DOORPOS_CLOSED_SWITCH_PORT_OUT PORTB
+#define DOORPOS_CLOSED_SWITCH_PORT_DIR DDRB
+
+/* set to 0 if the closed end stop switch is not fitted , a stall in the deceleration of the profile is then
+ * taken as the door arriving at the frame */
+#define DOORPOS_USE_CLOSED_SWITCH 1
+
+/* set to 1 if the motor has a quadrature encoder , channel A is on INT0 and channel B on PD6 */
+#define DOORPOS_USE_ENCODER 0
+#define DOORPOS_ENCODER_A_PIN PD2
+#define DOORPOS_ENCODER_B_PIN PD6
+#define DOORPOS_ENCODER_PORT_IN PIND
+#define DOORPOS_ENCODER_PORT_OUT PORTD
+#define DOORPOS_ENCODER_PORT_DIR DDRD
+/* encoder counts (two per cycle of channel A) from the closed end to the open end */
+#define DOORPOS_TRAVEL_COUNTS 1200
+
+/*
+ * Description: enumeration of the position of the door
+ */
+typedef enum
+{
+	DOORPOS_BETWEEN , DOORPOS_OPEN , DOORPOS_CLOSED
+}DoorPos_Position;
+
+void DOORPOS_init(void);                                     /* function prototype for initializing the inputs */
+void DOORPOS_setCallBack(void(*a_ptr)(DoorPos_Position));    /* function prototype for setting the arrival call back */
+bool DOORPOS_arm(DoorPos_Position a_target);                 /* function prototype for waiting for the door to arrive at an end */
+DoorPos_Position DOORPOS_getPosition(void);                  /* function prototype for reading the position of the door */
+sint16 DOORPOS_getCount(void);                               /* function prototype for reading the encoder count */
+
+#endif /* DOORPOS_H_ */
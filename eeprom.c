@@ -1,145 +1,341 @@
-/*------------------------------------------------------------------------------------------------------------------------------
- *
- * [FILE NAME]: external eeprom
- *
- * [AUTHOR]:   Shady Ali
- *
- * [DESCRIPTION]: source file for the external eeprom module
- *
- -----------------------------------------------------------------------------------------------------------------------------*/
-#include "eeprom.h"
-/**************************************************************************************************
- *                                     Functions Definitions                                      *
- **************************************************************************************************/
-/*Description: function to initialize the External EEPROM  module
- * the function initializes the internal I2C module and takes one argument of type Twi_ConfigType
- * set the required Bit Rate
- * set the required slave address
- * set the required prescale
- */
-void EEPROM_init(Twi_ConfigType *Twi_configPtr)
-{	/* initialize the internal I2C module with the required information through
-     *a structure of type Twi_ConfigType */
-	void TWI_init(Twi_ConfigPtr);
-}
-
-/* Description: function responsible for writing one byte in the External EEPROM
- * it takes two arguments: 1-the required address to store data , and 2-the required data to be stored
- * 1. send the start bit
- * 2. send the address of External EEPROM  with the MSB 3 Bits of internal address of EEPROM memory
- * 3. send the address of EEPROM in which the data will be stored at
- * 4. send the required data
- * 5. stop the I2C module
- * returns success or error
- */
-uint8 EEPROM_writeByte(uint16 a_address,uint8 a_data)
-{
-	/* Send the Start Bit */
-    TWI_start();
-    /* check if the start condition has been sent successfully */
-    if (TWI_getStatus() != TW_START)
-        return ERROR;
-    /* Send the device address, we need to get A8 A9 A10 address bits from the
-     * memory location address and R/W=0 (write) */
-    TWI_write((uint8)(0xA0 | ((a_address & 0x0700)>>7)));
-    /* check if the master transmit (slave address + write request) has been sent successfully
-     * and received ACK */
-    if (TWI_getStatus() != TW_MT_SLA_W_ACK)
-        return ERROR;
-    /* Send the required memory location address */
-    TWI_write((uint8)(a_address));
-    /* check if the master transmit address of EEPROM in which the data will be stored at
-     *  has been sent successfully and received ACK */
-    if (TWI_getStatus() != TW_MT_DATA_ACK)
-        return ERROR;
-    /* write byte to eeprom */
-    TWI_write(a_data);
-    /* check if the master transmit data has been sent successfully
-     * and received ACK */
-    if (TWI_getStatus() != TW_MT_DATA_ACK)
-        return ERROR;
-    /* Send the Stop Bit */
-    TWI_stop();
-    return SUCCESS;  /* return success if the byte has been sent successfullyu */
-}
-
-/* Description: function responsible for reading one byte from the External EEPROM
- * it takes two arguments:1- the required address the data stored at , and 2- pointer to the address of data
- * 1. send the start bit
- * 2. send the address of External EEPROM  with the MSB 3 Bits of internal address of EEPROM memory
- * 3. send the address of EEPROM in which the data will be stored at
- * 4. send repeated start
- * 5. send slave address
- * 6. read with negative ACK  and store the data at the pointer
- * 7. stop the I2C module
- * returns success or error
- */
-uint8 EEPROM_readByte(uint16 a_address, uint8 *a_dataPtr)
-{
-	/* Send the Start Bit */
-    TWI_start();
-    /* check if the start condition has been sent successfully */
-    if (TWI_getStatus() != TW_START)
-        return ERROR;
-    /* Send the device address, we need to get A8 A9 A10 address bits from the
-     * memory location address and R/W=0 (write) */
-    TWI_write((uint8)((0xA0) | ((a_address & 0x0700)>>7)));
-    /* check if the master transmit (slave address + write request) has been sent successfully
-     * and received ACK */
-    if (TWI_getStatus() != TW_MT_SLA_W_ACK)
-        return ERROR;
-    /* Send the required memory location address */
-    TWI_write((uint8)(a_address));
-    /* check if the master transmit address of EEPROM in which the data will be stored at
-     *  has been sent successfully and received ACK */
-    if (TWI_getStatus() != TW_MT_DATA_ACK)
-        return ERROR;
-    /* Send the Repeated Start Bit */
-    TWI_start();
-    /* check if the repeated start bit has been sent successfully */
-    if (TWI_getStatus() != TW_REP_START)
-        return ERROR;
-    /* Send the device address, we need to get A8 A9 A10 address bits from the
-     * memory location address and R/W=1 (Read) */
-    TWI_write((uint8)((0xA0) | ((a_address & 0x0700)>>7) | 1));
-    if (TWI_getStatus() != TW_MT_SLA_R_ACK)
-        return ERROR;
-    /* Read Byte from Memory without send ACK */
-    *a_dataPtr = TWI_readWithNACK();
-    /* check if the master received the data with negative ACK */
-    if (TWI_getStatus() != TW_MR_DATA_NACK)
-        return ERROR;
-    /* Send the Stop Bit */
-    TWI_stop();
-    return SUCCESS; /* chack if the byte has been received successfully */
-}
-
-/*Description: function responsible for writing 4 Bytes to the External EEPROM
- *it takes two arguments: 1-the required address to store data , and 2-the required data to be stored
- * send the four bytes by calling the function EEPROM_writeByte()
- */
-void EEPROM_writeArray(uint16 a_address, uint8 *a_dataPtr)
-{
-	uint8 i;
-	for(i=0;i<8;i++)
-	{
-		EEPROM_writeByte((a_address + i) , *a_dataPtr);
-		a_dataPtr++;
-		_delay_ms(10);
-	}
-}
-
-/*Description: function responsible for reading 4 Bytes from the External EEPROM
- *it takes two arguments: 1-the required address of the data , and 2-the address in which the data will be stored
- * read the four bytes by calling the function EEPROM_readByte()
- */
-void EEPROM_readArray(uint16 a_address , uint8 *a_dataPtr)
-{
-	uint8 i;
-	for(i=0;i<8;i++)
-	{
-		EEPROM_readByte((a_address + i) , a_dataPtr);
-		a_dataPtr++;
-		_delay_ms(10);
-	}
-}
+/*------------------------------------------------------------------------------------------------------------------------------
+ *
+ * [FILE NAME]: external eeprom
+ *
+ * [AUTHOR]:   Shady Ali
+ *
+ * [DESCRIPTION]: source file for the external eeprom module
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+#include "eeprom.h"
+#include "probe.h"
+/**************************************************************************************************
+ *                                       Global Variables                                         *
+ **************************************************************************************************/
+/* write cycles and busy polls seen since reset, read through EEPROM_getStats() */
+static Eeprom_StatsType g_eepromStats={0,0,0};
+
+/**************************************************************************************************
+ *                                   Private Functions Definitions                                *
+ **************************************************************************************************/
+/* Description: function to count one saturating statistic */
+static void EEPROM_count(uint16 *a_counterPtr)
+{
+	if(*a_counterPtr != 0xFFFF)
+	{
+		(*a_counterPtr)++;
+	}
+}
+
+/* Description: function responsible for sending the start bit and the device address of the
+ * block holding a_address with the required R/W bit
+ * returns the status code of the device address
+ */
+static uint8 EEPROM_select(uint16 a_address , uint8 a_read)
+{
+	TWI_start();
+	/* check if the start condition has been sent successfully */
+	if ((TWI_getStatus() != TW_START) && (TWI_getStatus() != TW_REP_START))
+		return TWI_getStatus();
+	/* Send the device address, we need to get A8 A9 A10 address bits from the
+	 * memory location address */
+	TWI_write((uint8)(0xA0 | ((a_address & 0x0700)>>7) | a_read));
+	return TWI_getStatus();
+}
+
+/* Description: function responsible for waiting the internal write cycle of the External EEPROM
+ * the device does not acknowledge its address until the cycle is over so keep sending its
+ * address until it answers (ACK polling), which ends the wait as soon as the write is done
+ * instead of waiting the worst case write time every time
+ * returns success or error if the device never answered
+ */
+static uint8 EEPROM_waitReady(uint16 a_address)
+{
+	uint8 polls;
+	uint8 status;
+	for(polls=0;polls<EEPROM_MAX_POLLS;polls++)
+	{
+		status=EEPROM_select(a_address , 0);
+		TWI_stop();
+		/* wait the stop bit to be sent before the next start bit */
+		while(BIT_IS_SET(TWCR,TWSTO));
+		if(status == TW_MT_SLA_W_ACK)
+		{
+			if(polls > g_eepromStats.maxPolls)
+			{
+				g_eepromStats.maxPolls=polls;
+			}
+			return SUCCESS;
+		}
+		EEPROM_count(&g_eepromStats.busyPolls);
+	}
+	return ERROR;
+}
+
+/**************************************************************************************************
+ *                                     Functions Definitions                                      *
+ **************************************************************************************************/
+/*Description: function to initialize the External EEPROM  module
+ * the function initializes the internal I2C module and takes one argument of type Twi_ConfigType
+ * set the required Bit Rate
+ * set the required slave address
+ * set the required prescale
+ */
+void EEPROM_init(Twi_ConfigType *Twi_configPtr)
+{	/* initialize the internal I2C module with the required information through
+     *a structure of type Twi_ConfigType */
+	TWI_init(Twi_configPtr);
+}
+
+/* Description: function responsible for writing one byte in the External EEPROM
+ * it takes two arguments: 1-the required address to store data , and 2-the required data to be stored
+ * 1. send the start bit
+ * 2. send the address of External EEPROM  with the MSB 3 Bits of internal address of EEPROM memory
+ * 3. send the address of EEPROM in which the data will be stored at
+ * 4. send the required data
+ * 5. stop the I2C module
+ * returns success or error , the bus is released on an error too
+ */
+uint8 EEPROM_writeByte(uint16 a_address,uint8 a_data)
+{
+	/* Send the Start Bit */
+    TWI_start();
+    /* check if the start condition has been sent successfully */
+    if (TWI_getStatus() != TW_START)
+    {
+        TWI_stop();
+        return ERROR;
+    }
+    /* Send the device address, we need to get A8 A9 A10 address bits from the
+     * memory location address and R/W=0 (write) */
+    TWI_write((uint8)(0xA0 | ((a_address & 0x0700)>>7)));
+    /* check if the master transmit (slave address + write request) has been sent successfully
+     * and received ACK */
+    if (TWI_getStatus() != TW_MT_SLA_W_ACK)
+    {
+        TWI_stop();
+        return ERROR;
+    }
+    /* Send the required memory location address */
+    TWI_write((uint8)(a_address));
+    /* check if the master transmit address of EEPROM in which the data will be stored at
+     *  has been sent successfully and received ACK */
+    if (TWI_getStatus() != TW_MT_DATA_ACK)
+    {
+        TWI_stop();
+        return ERROR;
+    }
+    /* write byte to eeprom */
+    TWI_write(a_data);
+    /* check if the master transmit data has been sent successfully
+     * and received ACK */
+    if (TWI_getStatus() != TW_MT_DATA_ACK)
+    {
+        TWI_stop();
+        return ERROR;
+    }
+    /* Send the Stop Bit */
+    TWI_stop();
+    EEPROM_count(&g_eepromStats.writeCycles);
+    /* wait the internal write cycle so the next access finds the EEPROM ready */
+    return EEPROM_waitReady(a_address);
+}
+
+/* Description: function responsible for reading one byte from the External EEPROM
+ * it takes two arguments:1- the required address the data stored at , and 2- pointer to the address of data
+ * 1. send the start bit
+ * 2. send the address of External EEPROM  with the MSB 3 Bits of internal address of EEPROM memory
+ * 3. send the address of EEPROM in which the data will be stored at
+ * 4. send repeated start
+ * 5. send slave address
+ * 6. read with negative ACK  and store the data at the pointer
+ * 7. stop the I2C module
+ * returns success or error , the bus is released on an error too
+ */
+uint8 EEPROM_readByte(uint16 a_address, uint8 *a_dataPtr)
+{
+	/* Send the Start Bit */
+    TWI_start();
+    /* check if the start condition has been sent successfully */
+    if (TWI_getStatus() != TW_START)
+    {
+        TWI_stop();
+        return ERROR;
+    }
+    /* Send the device address, we need to get A8 A9 A10 address bits from the
+     * memory location address and R/W=0 (write) */
+    TWI_write((uint8)((0xA0) | ((a_address & 0x0700)>>7)));
+    /* check if the master transmit (slave address + write request) has been sent successfully
+     * and received ACK */
+    if (TWI_getStatus() != TW_MT_SLA_W_ACK)
+    {
+        TWI_stop();
+        return ERROR;
+    }
+    /* Send the required memory location address */
+    TWI_write((uint8)(a_address));
+    /* check if the master transmit address of EEPROM in which the data will be stored at
+     *  has been sent successfully and received ACK */
+    if (TWI_getStatus() != TW_MT_DATA_ACK)
+    {
+        TWI_stop();
+        return ERROR;
+    }
+    /* Send the Repeated Start Bit */
+    TWI_start();
+    /* check if the repeated start bit has been sent successfully */
+    if (TWI_getStatus() != TW_REP_START)
+    {
+        TWI_stop();
+        return ERROR;
+    }
+    /* Send the device address, we need to get A8 A9 A10 address bits from the
+     * memory location address and R/W=1 (Read) */
+    TWI_write((uint8)((0xA0) | ((a_address & 0x0700)>>7) | 1));
+    if (TWI_getStatus() != TW_MT_SLA_R_ACK)
+    {
+        TWI_stop();
+        return ERROR;
+    }
+    /* Read Byte from Memory without send ACK */
+    *a_dataPtr = TWI_readWithNACK();
+    /* check if the master received the data with negative ACK */
+    if (TWI_getStatus() != TW_MR_DATA_NACK)
+    {
+        TWI_stop();
+        return ERROR;
+    }
+    /* Send the Stop Bit */
+    TWI_stop();
+    return SUCCESS; /* chack if the byte has been received successfully */
+}
+
+/*Description: function responsible for writing an array of Bytes to the External EEPROM
+ *it takes three arguments: 1-the required address to store data , 2-the required data to be stored
+ * and 3-the number of bytes
+ * the bytes are sent as page writes, a new page write starts at each page boundary because
+ * the EEPROM wraps the address inside the page, and each page costs one write cycle
+ * returns success or error
+ */
+uint8 EEPROM_writeArray(uint16 a_address, uint8 *a_dataPtr , uint8 a_size)
+{
+	uint8 chunk;
+	while(a_size > 0)
+	{
+		/* bytes left until the end of the current page */
+		chunk = EEPROM_PAGE_SIZE - (a_address & (EEPROM_PAGE_SIZE - 1));
+		if(chunk > a_size)
+		{
+			chunk = a_size;
+		}
+		if(EEPROM_select(a_address , 0) != TW_MT_SLA_W_ACK)
+		{
+			TWI_stop();
+			return ERROR;
+		}
+		/* Send the required memory location address */
+		TWI_write((uint8)(a_address));
+		if (TWI_getStatus() != TW_MT_DATA_ACK)
+		{
+			TWI_stop();
+			return ERROR;
+		}
+		a_address += chunk;
+		a_size -= chunk;
+		while(chunk > 0)
+		{
+			TWI_write(*a_dataPtr);
+			if (TWI_getStatus() != TW_MT_DATA_ACK)
+			{
+				TWI_stop();
+				return ERROR;
+			}
+			a_dataPtr++;
+			chunk--;
+		}
+		/* the stop bit starts the internal write cycle of the page */
+		TWI_stop();
+		EEPROM_count(&g_eepromStats.writeCycles);
+		if(EEPROM_waitReady(a_address) == ERROR)
+		{
+			return ERROR;
+		}
+	}
+	return SUCCESS;
+}
+
+/*Description: function responsible for reading the bytes in one sequential read, every byte is
+ * acknowledged except the last one
+ * returns success or error
+ */
+static uint8 EEPROM_readSequential(uint16 a_address , uint8 *a_dataPtr , uint8 a_size)
+{
+	if(a_size == 0)
+	{
+		return SUCCESS;
+	}
+	if(EEPROM_select(a_address , 0) != TW_MT_SLA_W_ACK)
+	{
+		TWI_stop();
+		return ERROR;
+	}
+	/* Send the required memory location address */
+	TWI_write((uint8)(a_address));
+	if (TWI_getStatus() != TW_MT_DATA_ACK)
+	{
+		TWI_stop();
+		return ERROR;
+	}
+	/* Send the Repeated Start Bit and the device address with R/W=1 (Read) */
+	if(EEPROM_select(a_address , 1) != TW_MT_SLA_R_ACK)
+	{
+		TWI_stop();
+		return ERROR;
+	}
+	while(a_size > 1)
+	{
+		*a_dataPtr = TWI_readWithACK();
+		if (TWI_getStatus() != TW_MR_DATA_ACK)
+		{
+			TWI_stop();
+			return ERROR;
+		}
+		a_dataPtr++;
+		a_size--;
+	}
+	/* Read the last Byte without send ACK to end the sequential read */
+	*a_dataPtr = TWI_readWithNACK();
+	if (TWI_getStatus() != TW_MR_DATA_NACK)
+	{
+		TWI_stop();
+		return ERROR;
+	}
+	/* Send the Stop Bit */
+	TWI_stop();
+	return SUCCESS;
+}
+
+/*Description: function responsible for reading an array of Bytes from the External EEPROM
+ *it takes three arguments: 1-the required address of the data , 2-the address in which the data will be stored
+ * and 3-the number of bytes
+ * the bytes are read in one sequential read
+ * returns success or error
+ */
+uint8 EEPROM_readArray(uint16 a_address , uint8 *a_dataPtr , uint8 a_size)
+{
+	uint8 result;
+	PROBE_ENTER(PROBE_EEPROM_READ);
+	result = EEPROM_readSequential(a_address , a_dataPtr , a_size);
+	PROBE_EXIT(PROBE_EEPROM_READ);
+	return result;
+}
+
+/*Description: function to get a copy of the statistics of the External EEPROM
+ * writeCycles: the internal write cycles started, each one wears the written page
+ * busyPolls: the device addresses not acknowledged while waiting a write cycle
+ * maxPolls: the longest wait of one write cycle in polls
+ */
+void EEPROM_getStats(Eeprom_StatsType *a_statsPtr)
+{
+	*a_statsPtr = g_eepromStats;
+}
@@ -1,77 +1,110 @@
-/*------------------------------------------------------------------------------------------------------------------------------
- *
- * [FILE NAME]: external eeprom
- *
- * [AUTHOR]:   Shady Ali
- *
- * [DESCRIPTION]: header file for the external eeprom module
- *
- -----------------------------------------------------------------------------------------------------------------------------*/
-
-#ifndef EEPROM_H_
-#define EEPROM_H_
-
-#include"twi.h"
-#include"micro_config.h"
-#include"std_types.h"
-#include"common_macros.h"
-/***********************************************************************************************
- *                                  Preprocessor Macros                                        *
- ***********************************************************************************************/
-#define ERROR 0
-#define SUCCESS 1
-#define TW_START         0x08 // start has been sent
-#define TW_REP_START     0x10 // repeated start
-#define TW_MT_SLA_W_ACK  0x18 // Master transmit ( slave address + Write request ) to slave + Ack received from slave
-#define TW_MT_SLA_R_ACK  0x40 // Master transmit ( slave address + Read request ) to slave + Ack received from slave
-#define TW_MT_DATA_ACK   0x28 // Master transmit data and ACK has been received from Slave.
-#define TW_MR_DATA_ACK   0x50 // Master received data and send ACK to slave
-#define TW_MR_DATA_NACK  0x58 // Master received data but doesn't send ACK to slave
-
-/***********************************************************************************************
- *                                  Functions Prototypes                                       *
- ***********************************************************************************************/
-/*Description: function to initialize the External EEPROM  module
- * the function initializes the internal I2C module and takes one argument of type Twi_ConfigType
- * set the required Bit Rate
- * set the required slave address
- * set the required prescale
- */
-void EEPROM_init(Twi_ConfigType *Twi_configPtr);
-
-/* Description: function responsible for writing one byte in the External EEPROM
- * it takes two arguments: 1-the required address to store data , and 2-the required data to be stored
- * 1. send the start bit
- * 2. send the address of External EEPROM  with the MSB 3 Bits of internal address of EEPROM memory
- * 3. send the address of EEPROM in which the data will be stored at
- * 4. send the required data
- * 5. stop the I2C module
- * returns success or error
- */
-uint8 EEPROM_writeByte(uint16 a_address,uint8 a_data);
-
-/* Description: function responsible for reading one byte from the External EEPROM
- * it takes two arguments: 1-the required address the data stored at , and 2-pointer to the address of data
- * 1. send the start bit
- * 2. send the address of External EEPROM  with the MSB 3 Bits of internal address of EEPROM memory
- * 3. send the address of EEPROM in which the data will be stored at
- * 4. send repeated start
- * 5. send slave address
- * 6. read with negative ACK  and store the data at the pointer
- * 7. stop the I2C module
- * returns success or error
- */
-uint8 EEPROM_readByte(uint16 a_address,uint8 *a_dataPtr);
-
-/*Description: function responsible for writing 4 Bytes to the External EEPROM
- *it takes two arguments: 1-the required address to store data , and 2-the required data to be stored
- * send the four bytes by calling the function EEPROM_writeByte()
- */
-void EEPROM_writeArray(uint16 a_address, uint8 *a_dataPtr);
-/*Description: function responsible for reading 4 Bytes from the External EEPROM
- *it takes two arguments: 1-the required address of the data , and 2-the address in which the data will be stored
- * read the four bytes by calling the function EEPROM_readByte()
- */
-void EEPROM_readArray(uint16 a_address , uint8 *a_dataPtr);
-
-#endif /* EEPROM_H_ */
+/*------------------------------------------------------------------------------------------------------------------------------
+ *
+ * [FILE NAME]: external eeprom
+ *
+ * [AUTHOR]:   Shady Ali
+ *
+ * [DESCRIPTION]: header file for the external eeprom module
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef EEPROM_H_
+#define EEPROM_H_
+
+#include"twi.h"
+#include"micro_config.h"
+#include"std_types.h"
+#include"common_macros.h"
+/***********************************************************************************************
+ *                                  Preprocessor Macros                                        *
+ ***********************************************************************************************/
+#define ERROR 0
+#define SUCCESS 1
+#define TW_START         0x08 // start has been sent
+#define TW_REP_START     0x10 // repeated start
+#define TW_MT_SLA_W_ACK  0x18 // Master transmit ( slave address + Write request ) to slave + Ack received from slave
+#define TW_MT_SLA_W_NACK 0x20 // Master transmit ( slave address + Write request ) to slave + no Ack, device busy
+#define TW_MT_SLA_R_ACK  0x40 // Master transmit ( slave address + Read request ) to slave + Ack received from slave
+#define TW_MT_DATA_ACK   0x28 // Master transmit data and ACK has been received from Slave.
+#define TW_MR_DATA_ACK   0x50 // Master received data and send ACK to slave
+#define TW_MR_DATA_NACK  0x58 // Master received data but doesn't send ACK to slave
+
+/* the bytes of one page write, a page write wraps inside its page */
+#define EEPROM_PAGE_SIZE 16
+/* device addresses sent while waiting a write cycle before giving up, each poll takes about
+ * 110us at 100KHz so the 10ms worst case write cycle ends in about 90 polls */
+#define EEPROM_MAX_POLLS 200
+
+/***********************************************************************************************
+ *                                  Types Declaration                                          *
+ ***********************************************************************************************/
+/*
+ * Description: structure of the statistics of the External EEPROM
+ * writeCycles: the internal write cycles started, each one wears the written page
+ * busyPolls: the device addresses not acknowledged while waiting a write cycle
+ * maxPolls: the longest wait of one write cycle in polls
+ */
+typedef struct
+{
+	uint16 writeCycles;
+	uint16 busyPolls;
+	uint8 maxPolls;
+}Eeprom_StatsType;
+
+/***********************************************************************************************
+ *                                  Functions Prototypes                                       *
+ ***********************************************************************************************/
+/*Description: function to initialize the External EEPROM  module
+ * the function initializes the internal I2C module and takes one argument of type Twi_ConfigType
+ * set the required Bit Rate
+ * set the required slave address
+ * set the required prescale
+ */
+void EEPROM_init(Twi_ConfigType *Twi_configPtr);
+
+/* Description: function responsible for writing one byte in the External EEPROM
+ * it takes two arguments: 1-the required address to store data , and 2-the required data to be stored
+ * 1. send the start bit
+ * 2. send the address of External EEPROM  with the MSB 3 Bits of internal address of EEPROM memory
+ * 3. send the address of EEPROM in which the data will be stored at
+ * 4. send the required data
+ * 5. stop the I2C module
+ * 6. wait the internal write cycle by polling the device address
+ * returns success or error
+ */
+uint8 EEPROM_writeByte(uint16 a_address,uint8 a_data);
+
+/* Description: function responsible for reading one byte from the External EEPROM
+ * it takes two arguments: 1-the required address the data stored at , and 2-pointer to the address of data
+ * 1. send the start bit
+ * 2. send the address of External EEPROM  with the MSB 3 Bits of internal address of EEPROM memory
+ * 3. send the address of EEPROM in which the data will be stored at
+ * 4. send repeated start
+ * 5. send slave address
+ * 6. read with negative ACK  and store the data at the pointer
+ * 7. stop the I2C module
+ * returns success or error
+ */
+uint8 EEPROM_readByte(uint16 a_address,uint8 *a_dataPtr);
+
+/*Description: function responsible for writing an array of Bytes to the External EEPROM
+ *it takes three arguments: 1-the required address to store data , 2-the required data to be stored
+ * and 3-the number of bytes
+ * send the bytes in page writes split at the page boundaries
+ * returns success or error
+ */
+uint8 EEPROM_writeArray(uint16 a_address, uint8 *a_dataPtr , uint8 a_size);
+/*Description: function responsible for reading an array of Bytes from the External EEPROM
+ *it takes three arguments: 1-the required address of the data , 2-the address in which the data will be stored
+ * and 3-the number of bytes
+ * read the bytes in one sequential read
+ * returns success or error
+ */
+uint8 EEPROM_readArray(uint16 a_address , uint8 *a_dataPtr , uint8 a_size);
+
+/*Description: function to get a copy of the statistics of the External EEPROM
+ * it takes one argument: pointer to the structure to fill
+ */
+void EEPROM_getStats(Eeprom_StatsType *a_statsPtr);
+
+#endif /* EEPROM_H_ */
@@ -0,0 +1,164 @@
+/*------------------------------------------------------------------------------------------------------------------------------
+ *
+ * [FILE NAME]: entry
+ *
+ * [AUTHOR]:   Shady Ali
+ *
+ * [DESCRIPTION]: source file for the PIN entry component of the Human Interface ECU
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+#include"entry.h"
+#include<stdio.h>
+
+/******************************************************************************************************
+ *                                               Global Variables                                     *
+ *****************************************************************************************************/
+/* the message displayed on the first row while typing */
+static const char *g_prompt;
+/* the typed digits */
+static uint8 g_digits[PIN_MAX_LENGTH];
+/* number of the typed digits */
+static uint8 g_count = 0;
+/* ticks left before the entry is cancelled */
+static uint16 g_ticksLeft = 0;
+/* TRUE while there is an active entry */
+static bool g_active = FALSE;
+/* the function called for every accepted key */
+static void (*g_callBackPtr) (uint8 a_key)=NULL;
+
+/*******************************************************************************************************
+ *                                          Private Functions Prototypes                               *
+ ******************************************************************************************************/
+static void ENTRY_display(void);
+
+/*******************************************************************************************************
+ *                                              Functions Definitions                                  *
+ *******************************************************************************************************/
+
+/* [Description]: function responsible for displaying the prompt and moving the cursor to the digits position
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+static void ENTRY_display(void)
+{
+	LCD_clearScreen();
+	LCD_displayString(g_prompt);
+	LCD_goToRowColumn(1,ENTRY_DIGITS_COLUMN);
+}
+
+/* [Description]: function responsible for starting a new entry , it displays the prompt on the first row
+ * 				  and clears the typed digits
+ * [Arguments]: the message to be displayed while the password is typed
+ * [Returns]: no return
+ */
+void ENTRY_start(const char *a_prompt)
+{
+	g_prompt = a_prompt;
+	g_count = 0;
+	g_ticksLeft = ENTRY_TIMEOUT_TICKS;
+	g_active = TRUE;
+	ENTRY_display();
+}
+
+/* [Description]: function responsible for handling one key event of the active entry
+ * 				  a digit is stored and displayed as '*' , the clear key starts the entry again
+ * 				  the confirm key completes the entry and any other key is ignored
+ * [Arguments]: the pressed key
+ * [Returns]: ENTRY_COMPLETE when the entry is confirmed or PIN_MAX_LENGTH digits are typed ,
+ * 			  ENTRY_BUSY while typing and ENTRY_INACTIVE if there is no active entry
+ */
+Entry_Status ENTRY_feedKey(uint8 a_key)
+{
+	if(g_active == FALSE)
+	{
+		return ENTRY_INACTIVE;
+	}
+	/* any key restarts the timeout */
+	g_ticksLeft = ENTRY_TIMEOUT_TICKS;
+	if(a_key <= 9)
+	{
+		/* if the pressed key is a number store it and display '*' */
+		g_digits[g_count] = a_key;
+		g_count++;
+		LCD_displayCharacter('*');
+		if(g_callBackPtr != NULL)
+		{
+			(*g_callBackPtr)(a_key);
+		}
+		if(g_count == PIN_MAX_LENGTH)
+		{
+			/* there is no place for more digits so the entry is complete */
+			g_active = FALSE;
+			return ENTRY_COMPLETE;
+		}
+	}
+	else if(a_key == ENTRY_CLEAR_KEY)
+	{
+		/* if the pressed key is 'enter' repeat the entry from the beginning */
+		g_count = 0;
+		ENTRY_display();
+		if(g_callBackPtr != NULL)
+		{
+			(*g_callBackPtr)(ENTRY_CLEAR_KEY);
+		}
+	}
+	else if((a_key == ENTRY_CONFIRM_KEY) && (g_count >= PIN_MIN_LENGTH))
+	{
+		g_active = FALSE;
+		return ENTRY_COMPLETE;
+	}
+	return ENTRY_BUSY;
+}
+
+/* [Description]: function responsible for the timeout of the active entry , it should be called every tick
+ * [Arguments]: no arguments
+ * [Returns]: ENTRY_TIMEOUT when the entry is cancelled because no key was pressed for ENTRY_TIMEOUT_TICKS
+ */
+Entry_Status ENTRY_tick(void)
+{
+	if(g_active == FALSE)
+	{
+		return ENTRY_INACTIVE;
+	}
+	g_ticksLeft--;
+	if(g_ticksLeft == 0)
+	{
+		g_active = FALSE;
+		return ENTRY_TIMEOUT;
+	}
+	return ENTRY_BUSY;
+}
+
+/* [Description]: function responsible for indicating if there is an active entry
+ * [Arguments]: no arguments
+ * [Returns]: TRUE while the user is typing and FALSE otherwise
+ */
+bool ENTRY_isActive(void)
+{
+	return g_active;
+}
+
+/* [Description]: function responsible for copying the typed password after the entry is complete
+ * [Arguments]: the address of the array in which the password will be stored (PIN_MAX_LENGTH bytes)
+ * [Returns]: the number of the typed digits
+ */
+uint8 ENTRY_getPin(uint8 *a_pinPtr)
+{
+	uint8 i;
+	for(i=0;i<g_count;i++)
+	{
+		a_pinPtr[i] = g_digits[i];
+	}
+	return g_count;
+}
+
+/* [Description]: function responsible for setting the function called for every accepted key of the entry
+ * 				  it is called with the value of the typed digit or ENTRY_CLEAR_KEY when the digits are cleared
+ * 				  so the digits can be streamed while they are typed
+ * [Arguments]: the address of the function or NULL to stop calling it
+ * [Returns]: no return
+ */
+void ENTRY_setCallBack(void(*a_ptr)(uint8 a_key))
+{
+	g_callBackPtr = a_ptr;
+}
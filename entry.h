@@ -0,0 +1,95 @@
+/*------------------------------------------------------------------------------------------------------------------------------
+ *
+ * [FILE NAME]: entry.h
+ *
+ * [AUTHOR]:   Shady Ali
+ *
+ * [DESCRIPTION]: header file for the PIN entry component of the Human Interface ECU
+ * 				  the component is fed by key events and never waits so the main loop stays responsive
+ * 				  while the user is typing the password
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef ENTRY_H_
+#define ENTRY_H_
+
+#include"std_types.h"
+#include"common_macros.h"
+#include"lcd.h"
+
+/***************************************************************************************
+ *                                 Preprocessor Macros                                 *
+ **************************************************************************************/
+/* minimum and maximum number of digits of the password , the length is chosen when the password is set */
+#define PIN_MIN_LENGTH 4
+#define PIN_MAX_LENGTH 12
+/* key used to clear the typed digits and start the entry again */
+#define ENTRY_CLEAR_KEY 13
+/* key used to confirm the typed digits when there are at least PIN_MIN_LENGTH of them */
+#define ENTRY_CONFIRM_KEY '='
+/* column of the second row at which the '*' of the typed digits are displayed */
+#define ENTRY_DIGITS_COLUMN 2
+/* period in milli seconds of the tick that calls ENTRY_tick , it must be TICK_MS of the HMI ECU */
+#define ENTRY_TICK_MS 8
+/* seconds without a key before the entry is cancelled and the number of calls of ENTRY_tick they take */
+#define ENTRY_TIMEOUT_SECONDS 15
+#define ENTRY_TIMEOUT_TICKS ((ENTRY_TIMEOUT_SECONDS*1000UL)/ENTRY_TICK_MS)
+
+/***************************************************************************************
+ *                                 Types Declaration                                   *
+ **************************************************************************************/
+/*
+ * Description: enumeration of the status returned by the entry component
+ */
+typedef enum
+{
+	ENTRY_INACTIVE , ENTRY_BUSY , ENTRY_COMPLETE , ENTRY_TIMEOUT
+}Entry_Status;
+
+/**************************************************************************************
+ *                             Functions Prototypes                                   *
+ **************************************************************************************/
+
+/* [Description]: function responsible for starting a new entry , it displays the prompt on the first row
+ * 				  and clears the typed digits
+ * [Arguments]: the message to be displayed while the password is typed
+ * [Returns]: no return
+ */
+void ENTRY_start(const char *a_prompt);
+
+/* [Description]: function responsible for handling one key event of the active entry
+ * 				  a digit is stored and displayed as '*' , the clear key starts the entry again
+ * 				  the confirm key completes the entry and any other key is ignored
+ * [Arguments]: the pressed key
+ * [Returns]: ENTRY_COMPLETE when the entry is confirmed or PIN_MAX_LENGTH digits are typed ,
+ * 			  ENTRY_BUSY while typing and ENTRY_INACTIVE if there is no active entry
+ */
+Entry_Status ENTRY_feedKey(uint8 a_key);
+
+/* [Description]: function responsible for the timeout of the active entry , it should be called every tick
+ * [Arguments]: no arguments
+ * [Returns]: ENTRY_TIMEOUT when the entry is cancelled because no key was pressed for ENTRY_TIMEOUT_TICKS
+ */
+Entry_Status ENTRY_tick(void);
+
+/* [Description]: function responsible for indicating if there is an active entry
+ * [Arguments]: no arguments
+ * [Returns]: TRUE while the user is typing and FALSE otherwise
+ */
+bool ENTRY_isActive(void);
+
+/* [Description]: function responsible for copying the typed password after the entry is complete
+ * [Arguments]: the address of the array in which the password will be stored (PIN_MAX_LENGTH bytes)
+ * [Returns]: the number of the typed digits
+ */
+uint8 ENTRY_getPin(uint8 *a_pinPtr);
+
+/* [Description]: function responsible for setting the function called for every accepted key of the entry
+ * 				  it is called with the value of the typed digit or ENTRY_CLEAR_KEY when the digits are cleared
+ * 				  so the digits can be streamed while they are typed
+ * [Arguments]: the address of the function or NULL to stop calling it
+ * [Returns]: no return
+ */
+void ENTRY_setCallBack(void(*a_ptr)(uint8 a_key));
+
+#endif /* ENTRY_H_ */
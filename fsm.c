@@ -0,0 +1,119 @@
+  /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: State Machine
+ *
+ * [File Name]:fsm.c
+ *
+ * [Description]: source file for the table driven State Machine
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+#include"fsm.h"
+#include<avr/pgmspace.h>
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: FSM_init
+ * [Description]:   function responsible for starting the machine in a_initialState , the table , the number
+ * 					of events , the time function and the array of the state times should be set before
+ * [Args]: Fsm_Type *a_fsm_Ptr , uint8 a_initialState
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void FSM_init(Fsm_Type *a_fsm_Ptr , uint8 a_initialState)
+{
+	a_fsm_Ptr->s_state = a_initialState;
+	a_fsm_Ptr->s_enteredTime = a_fsm_Ptr->getTime();
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: FSM_dispatch
+ * [Description]:   function responsible for taking the transition of a_event in the current state , the time spent
+ * 					in the state is counted , the trace hook is called , the state is changed then the function
+ * 					of the transition is called so it can dispatch the next event
+ * [Args]: Fsm_Type *a_fsm_Ptr , uint8 a_event
+ * [Returns]: bool : FALSE if the event is ignored in the current state
+ -----------------------------------------------------------------------------------------------------------------------------*/
+bool FSM_dispatch(Fsm_Type *a_fsm_Ptr , uint8 a_event)
+{
+	const Fsm_TransitionType *entry_Ptr;
+	uint8 nextState;
+	void (*action)(void);
+	uint32 now;
+	if(a_event >= a_fsm_Ptr->s_numberOfEvents)
+	{
+		return FALSE;
+	}
+	entry_Ptr = &a_fsm_Ptr->s_table_Ptr[(a_fsm_Ptr->s_state * a_fsm_Ptr->s_numberOfEvents) + a_event];
+	nextState = pgm_read_byte(&entry_Ptr->nextState);
+	if(nextState == FSM_IGNORE)
+	{
+		return FALSE;
+	}
+	action = (void(*)(void))pgm_read_ptr(&entry_Ptr->action);
+	/* count the time spent in the state until this transition */
+	now = a_fsm_Ptr->getTime();
+	a_fsm_Ptr->s_stateTime_Ptr[a_fsm_Ptr->s_state] += now - a_fsm_Ptr->s_enteredTime;
+	a_fsm_Ptr->s_enteredTime = now;
+	if(a_fsm_Ptr->traceHook != NULL)
+	{
+		a_fsm_Ptr->traceHook(a_fsm_Ptr->s_state , a_event , nextState);
+	}
+	a_fsm_Ptr->s_state = nextState;
+	if(action != NULL)
+	{
+		action();
+	}
+	return TRUE;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: FSM_getState
+ * [Description]:   function responsible for reading the current state
+ * [Args]: const Fsm_Type *a_fsm_Ptr
+ * [Returns]: uint8
+ -----------------------------------------------------------------------------------------------------------------------------*/
+uint8 FSM_getState(const Fsm_Type *a_fsm_Ptr)
+{
+	return a_fsm_Ptr->s_state;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: FSM_getStateTime
+ * [Description]:   function responsible for reading the time spent in a state including the time since it was
+ * 					entered if it is the current state
+ * [Args]: const Fsm_Type *a_fsm_Ptr , uint8 a_state
+ * [Returns]: uint32
+ -----------------------------------------------------------------------------------------------------------------------------*/
+uint32 FSM_getStateTime(const Fsm_Type *a_fsm_Ptr , uint8 a_state)
+{
+	uint32 time = a_fsm_Ptr->s_stateTime_Ptr[a_state];
+	if(a_state == a_fsm_Ptr->s_state)
+	{
+		time += a_fsm_Ptr->getTime() - a_fsm_Ptr->s_enteredTime;
+	}
+	return time;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: FSM_getTimeInState
+ * [Description]:   function responsible for reading the time since the current state was entered , a transition
+ * 					to the same state starts it again
+ * [Args]: const Fsm_Type *a_fsm_Ptr
+ * [Returns]: uint32
+ -----------------------------------------------------------------------------------------------------------------------------*/
+uint32 FSM_getTimeInState(const Fsm_Type *a_fsm_Ptr)
+{
+	return a_fsm_Ptr->getTime() - a_fsm_Ptr->s_enteredTime;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: FSM_setTraceHook
+ * [Description]:   function responsible for setting the function called on every transition with the state ,
+ * 					the event and the next state , it is called before the function of the transition
+ * [Args]: Fsm_Type *a_fsm_Ptr , the address of the function or NULL to stop tracing
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void FSM_setTraceHook(Fsm_Type *a_fsm_Ptr , void(*a_ptr)(uint8 a_state , uint8 a_event , uint8 a_nextState))
+{
+	a_fsm_Ptr->traceHook = a_ptr;
+}
@@ -0,0 +1,64 @@
+ /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: State Machine
+ *
+ * [File Name]: fsm.h
+ *
+ * [Description]: header file for the table driven State Machine , the transitions of every state and event are
+ * 				  stored in a table in the flash so an event is dispatched with one table lookup , every
+ * 				  transition can be traced and the time spent in every state is counted
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef FSM_H_
+#define FSM_H_
+
+#include"common_macros.h"
+#include"micro_config.h"
+#include"std_types.h"
+
+/* the next state of an event that is ignored in a state */
+#define FSM_IGNORE 0xFF
+/* a table entry of an ignored event */
+#define FSM_IGNORED {FSM_IGNORE , NULL}
+
+/*
+ * Description: structure of one entry of the transition table : the next state and the function called
+ * on the transition (or NULL) , the current state is changed before the function is called
+ */
+typedef struct
+{
+	uint8 nextState;
+	void (*action)(void);
+}Fsm_TransitionType;
+
+/*
+ * Description: structure of a State Machine
+ * 1. the transition table in the flash , one row of s_numberOfEvents entries for every state
+ * 2. the number of events
+ * 3. the function that returns the time used for the accounting (ticks)
+ * 4. an array with one time for every state to count the time spent in it
+ * 5. the function called on every transition (or NULL)
+ * 6. the current state and the time it was entered
+ */
+typedef struct
+{
+	const Fsm_TransitionType *s_table_Ptr;
+	uint8 s_numberOfEvents;
+	uint32 (*getTime)(void);
+	uint32 *s_stateTime_Ptr;
+	void (*traceHook)(uint8 a_state , uint8 a_event , uint8 a_nextState);
+	uint8 s_state;
+	uint32 s_enteredTime;
+}Fsm_Type;
+
+void FSM_init(Fsm_Type *a_fsm_Ptr , uint8 a_initialState);           /* function prototype for starting the machine in a state */
+bool FSM_dispatch(Fsm_Type *a_fsm_Ptr , uint8 a_event);              /* function prototype for dispatching an event */
+uint8 FSM_getState(const Fsm_Type *a_fsm_Ptr);                       /* function prototype for reading the current state */
+uint32 FSM_getStateTime(const Fsm_Type *a_fsm_Ptr , uint8 a_state);  /* function prototype for reading the time spent in a state */
+uint32 FSM_getTimeInState(const Fsm_Type *a_fsm_Ptr);                /* function prototype for reading the time since the current state was entered */
+void FSM_setTraceHook(Fsm_Type *a_fsm_Ptr , void(*a_ptr)(uint8 a_state , uint8 a_event , uint8 a_nextState)); /* function prototype for setting the trace hook */
+
+#endif /* FSM_H_ */
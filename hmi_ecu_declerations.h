@@ -1,141 +1,377 @@
-/*------------------------------------------------------------------------------------------------------------------------------
- *
- * [FILE NAME]:  hmi_ecu_declerations
- *
- * [AUTHOR]:   Shady Ali
- *
- * [DATE] [CREATED]:  Dec 5, 2020
- *
- * [DESCRIPTION]: header file for the functions of the Human Interface ECU
- * 				  The file contain the Prototypes of functions for HMI_ECU and the Preprocessor macros
- *				   and the Global variables
- -----------------------------------------------------------------------------------------------------------------------------*/
-
-#ifndef HMI_ECU_DECLERATIONS_H_
-#define HMI_ECU_DECLERATIONS_H_
-
-#include"lcd.h"
-#include"timer.h"
-#include"uart.h"
-#include"keypad.h"
-#include <avr/eeprom.h>
-
-
-/************************************************************************************************
- * 										PreProcessor Macros										*
- ***********************************************************************************************/
-#define NEW_PASSWORD 0x0A
-#define PASSWORD_IS_SAVED 0x0B
-#define CHANGE_PASSWORD 0x0C
-#define OPEN_DOOR 0x0D
-#define PASSWORD_IS_RIGHT 0x0E
-#define PASSWORD_IS_WRONG 0x0F
-#define PRECEDE_CHANGE 0x01
-#define DONT_CHANGE 0x02
-#define PASSWORD_IS_CHANGED 0x03
-#define FIRST_TIME_ADDRESS 0x22
-
-/************************************************************************************************
- * 										Global Variables										*
- ***********************************************************************************************/
-
-/* global variable to indicate the received byte from the CONTROL ECU */
-extern volatile uint8 g_select;
-/* global variable to count the number of seconds for the Timer Module*/
-extern volatile uint8 g_numberOfSeconds;
-/* global variable indicating if its the first time for the system or not */
-extern volatile uint8 flag;
-/* global variable indicating if there is a pressed button */
-extern volatile uint8 condition;
-/* global variable to count how many times the password was entered wrong */
-extern volatile uint8 wrong_counter;
-
-/************************************************************************************************
- * 										  Function Prototypes									*
- ***********************************************************************************************/
-/* [Description]: prototype for the call back function for the Receive interrupt of the UART module for HMI ECU
- * 				  it should receive the byte and set the value for g_select variable indicating the mode
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void HMI_uartAppProcessing(void);
-/* [Description]: prototype for the call back function for the interrupt of Timer Module for the function
- * 				  open door for HMI ECU it should increment the number of seconds  and if the seconds =15 or 18
- * 				  it display a message on the LCD
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void HMI_timerOpenDoorProcessing(void);
-/* [Description]: prototype for the call back function for the interrupt of Timer Module for the function
- *				 Buzzer on for HMI ECU it should increment the number of seconds
- *				 and if the seconds =60 it stops the buzzer
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void HMI_timerBuzzerProcessing(void);
-/* [Description]: function responsiple for indicating if two arrays are equal or not
- * [Arguments]: it takes two arrays addresses and the size of the array
- * [Returns]: return 1 if the two arrays are equal
- * 			  return 0 if the two arrays are different
- */
-uint8 HMI_compare(uint8 *a_first , uint8 *a_second , uint8 a_arraySize);
-/* [Description]: function responsible for displaying the diplaying of main options on LCD
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void HMI_displayMainOptions(void);
-/* [Description]: function responsible for displaying a message indicating that the system is locked
- * 				  it should display the message for one minute using TIMER module
- * [Arguments]: it takes a structure of type Timer_ConfigType to initialize the timer
- * [Returns]: no return
- */
-void HMI_buzzerOnForOneMinute(Timer_ConfigType *Timer_ConfigPtr);
-/* [Description]: function responsible for turning the buzzer of an display the main options again
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void HMI_buzzerOff(void);
-/* [Description]: function responsible for taking the password from the KeyPad module
- * 				  and take the password again if the both password are equal send to the CONTROL ECU
- * 				  to set the password and send the password this function should display only one
- * 				  time at the beginning of the sysytem
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void HMI_setPassword(void);
-/* [Description]: function responsible for taking the password from the KeyPad module
- * 				  and send to the CONTROL ECU to change password then send the password
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void HMI_changePassword(void);
-/* [Description]: function responsible for taking the password from the KeyPad module
- * 				  and send to the CONTROL ECU to open the door then send the password
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void HMI_openDoor (void);
-/* [Description]: function responsible for initializing the TIMER module and displaying the open door messages
- * [Arguments]: a structure of typr Timer_ConfigType
- * [Returns]: no return
- */
-void HMI_displayOpenDoor(Timer_ConfigType *Timer_ConfigPtr);
-/* [Description]: function responsible for initializing the TIMER module and displaying
- * 				  that the entered password is wrong if the entered password is wrong for 3 times
- * 				  it should turn on the Buzzer
- * [Arguments]: a structure of type Timer_ConfigType
- * [Returns]: no return
- */
-void HMI_wrongPassword(Timer_ConfigType *Timer_ConfigPtr);
-/* [Description]: function responsible for taking the password from the KeyPad module
- * 				  and take the password again if the both password are equal send to the CONTROL ECU
- * 				  to set the new password and send the password
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void HMI_precedeChange(void);
-
-
-
-
-#endif /* HMI_ECU_DECLERATIONS_H_ */
+/*------------------------------------------------------------------------------------------------------------------------------
+ *
+ * [FILE NAME]:  hmi_ecu_declerations
+ *
+ * [AUTHOR]:   Shady Ali
+ *
+ * [DATE] [CREATED]:  Dec 5, 2020
+ *
+ * [DESCRIPTION]: header file for the functions of the Human Interface ECU
+ * 				  The file contain the Prototypes of functions for HMI_ECU and the Preprocessor macros
+ *				   and the Global variables
+ -----------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef HMI_ECU_DECLERATIONS_H_
+#define HMI_ECU_DECLERATIONS_H_
+
+#include"lcd.h"
+#include"timer.h"
+#include"uart.h"
+#include"keypad.h"
+#include"entry.h"
+#include"fsm.h"
+#include"queue.h"
+#include"sched.h"
+#include"latency.h"
+#include"keytrace.h"
+#include <avr/eeprom.h>
+
+
+/************************************************************************************************
+ * 										PreProcessor Macros										*
+ ***********************************************************************************************/
+#define NEW_PASSWORD 0x0A
+#define PASSWORD_IS_SAVED 0x0B
+#define CHANGE_PASSWORD 0x0C
+#define OPEN_DOOR 0x0D
+#define PASSWORD_IS_RIGHT 0x0E
+#define PASSWORD_IS_WRONG 0x0F
+#define PRECEDE_CHANGE 0x01
+#define DONT_CHANGE 0x02
+#define PASSWORD_IS_CHANGED 0x03
+/* the digits of the password are streamed one byte each : PIN_DIGIT + the digit */
+#define PIN_DIGIT 0x30
+#define PIN_CLEAR 0x1C
+#define PIN_END 0x1D
+#define STATUS_QUERY 0x10
+#define SYSTEM_LOCKED 0x11
+#define SYSTEM_READY 0x12
+/* the CONTROL ECU tells the HMI ECU every change of the state of the door : DOOR_STATE followed by the state */
+#define DOOR_STATE 0x13
+#define DOOR_UNLOCKING 0
+#define DOOR_OPEN 1
+#define DOOR_LOCKING 2
+#define DOOR_LOCKED 3
+#define DOOR_FAULT 4
+/* the HMI ECU asks to stop the door at once or to keep it open for longer */
+#define EMERGENCY_STOP 0x14
+#define EXTEND_HOLD 0x15
+/* the keys used while the door is moving : ON/C stops the door and '=' keeps it open */
+#define DOOR_STOP_KEY 13
+#define DOOR_HOLD_KEY '='
+/* set to 1 to replay the recorded keys when KEYTRACE_REPLAY_KEY is pressed on the main options , the trace holds
+ * the typed passwords too so only on the bench */
+#define KEYTRACE_REPLAY_ENABLE 0
+#define KEYTRACE_REPLAY_KEY '*'
+/* set to 1 to display the wake ups and the seconds awake when SLEEP_STATS_KEY is pressed on the main options ,
+ * the benchmark of the power saving reads them on the bench */
+#define SLEEP_STATS_ENABLE 0
+#define SLEEP_STATS_KEY '%'
+#define FIRST_TIME_ADDRESS 0x22
+
+/* period of the system tick generated by Timer 1 in milli seconds */
+#define TICK_MS 8
+#define TICKS_PER_SECOND (1000/TICK_MS)
+#if (ENTRY_TICK_MS != TICK_MS)
+#error "ENTRY_TICK_MS of entry.h must be the period of the tick"
+#endif
+/* ticks waited in HMI_WAITING for the reply of the CONTROL ECU before going back to the main options ,
+ * a reply lost on the link (a byte dropped for a framing or parity error) would keep the HMI waiting */
+#define HMI_REPLY_TIMEOUT_TICKS (2*TICKS_PER_SECOND)
+/* compare value of Timer 1 clocked by F_CPU/8 for one tick */
+#define TICK_COMPARE_VALUE (((F_CPU/8)/1000)*TICK_MS - 1)
+
+/* the states of the HMI ECU */
+#define HMI_SETUP 0     /* the password is set for the first time */
+#define HMI_MENU 1      /* the main options are displayed */
+#define HMI_TYPING 2    /* a password is typed on the KeyPad */
+#define HMI_WAITING 3   /* waiting for the reply of the CONTROL ECU */
+#define HMI_LOCKED 4    /* the count down of the lockout is displayed */
+#define HMI_DOOR 5      /* the states of the door are displayed */
+#define HMI_STATES 6
+
+/* the events of the state machine of the HMI ECU */
+#define EVENT_CHANGE_KEY 0      /* '+' is pressed on the main options */
+#define EVENT_OPEN_KEY 1        /* '-' is pressed on the main options */
+#define EVENT_ENTRY_SENT 2      /* the typed password is sent to be checked */
+#define EVENT_PASSWORD_SET 3    /* the new password is confirmed and sent */
+#define EVENT_ENTRY_TIMEOUT 4   /* nobody typed for the timeout of the entry */
+#define EVENT_PASSWORD_WRONG 5  /* PASSWORD_IS_WRONG or DONT_CHANGE is received */
+#define EVENT_PRECEDE_CHANGE 6  /* PRECEDE_CHANGE is received */
+#define EVENT_SYSTEM_LOCKED 7   /* SYSTEM_LOCKED and its seconds are received */
+#define EVENT_LOCKOUT_OVER 8    /* the count down of the lockout is over */
+#define EVENT_DOOR_MOVING 9     /* the door is unlocking , open or locking */
+#define EVENT_DOOR_DONE 10      /* the door is locked or stopped */
+#define EVENT_REPLY_TIMEOUT 11  /* no reply is received for HMI_REPLY_TIMEOUT_TICKS */
+#define HMI_EVENTS 12
+#define EVENT_NONE 0xFF
+/* the UART interrupt queues EVENT_DOOR_STATE + the state of the door , it is given to the state machine
+ * as EVENT_DOOR_MOVING or EVENT_DOOR_DONE so every state is displayed even if two are queued */
+#define EVENT_DOOR_STATE 0x20
+/* number of events that can wait for the main loop , a power of 2 */
+#define EVENT_QUEUE_SIZE 8
+
+/* the stages of opening the door measured in micro seconds (g_latency) */
+#define LATENCY_ENTRY 0       /* from the confirm key to the end of the password sent */
+#define LATENCY_ROUND_TRIP 1  /* from the end of the password sent to the first byte of the reply */
+#define LATENCY_DISPLAY 2     /* displaying the reply on the LCD */
+#define LATENCY_TOTAL 3       /* from the confirm key to the reply displayed */
+#define LATENCY_STAGES 4
+
+/* the tasks of the HMI ECU in the table of the Scheduler */
+#define HMI_LINK_TASK 0
+#define HMI_KEYPAD_TASK 1
+#define HMI_LCD_TASK 2
+#define HMI_TASKS 3
+
+/************************************************************************************************
+ * 										Types Declaration										*
+ ***********************************************************************************************/
+/* Description: enumeration of what the typed password will be used for when the entry is complete */
+typedef enum
+{
+	ENTER_NEW_PASSWORD , CONFIRM_NEW_PASSWORD , ENTER_CHANGED_PASSWORD , CONFIRM_CHANGED_PASSWORD ,
+	ENTER_OPEN_DOOR_PASSWORD , ENTER_CURRENT_PASSWORD
+}HMI_EntryPurpose;
+
+/************************************************************************************************
+ * 										Global Variables										*
+ ***********************************************************************************************/
+
+/* the state machine of the HMI ECU */
+extern Fsm_Type g_hmiFsm;
+/* the statistics of the stages of opening the door */
+extern Latency_StatType g_latency[LATENCY_STAGES];
+/* global variable holding the seconds left of the lockout received from the CONTROL ECU */
+extern volatile uint16 g_lockoutSeconds;
+/* global variable holding the last state of the door received from the CONTROL ECU */
+extern volatile uint8 g_doorState;
+
+/************************************************************************************************
+ * 										  Function Prototypes									*
+ ***********************************************************************************************/
+/* [Description]: prototype for the call back function for the Receive interrupt of the UART module for HMI ECU
+ * 				  it should receive the byte and queue the event of the message for the main loop
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_uartAppProcessing(void);
+/* [Description]: function responsible for taking the oldest event queued by the interrupts for the main loop
+ * [Arguments]: no arguments
+ * [Returns]: the event or EVENT_NONE if there is no event
+ */
+uint8 HMI_getEvent(void);
+/* [Description]: function responsible for checking if the interrupts queued an event without taking it
+ * 				  so it can be called with the interrupts disabled before sleeping
+ * [Arguments]: no arguments
+ * [Returns]: TRUE if there is an event
+ */
+bool HMI_isEventPending(void);
+/* [Description]: function responsible for reading the time since the start in counts of Timer 1 (1 us) , it is
+ * 				  the time of the run time of the tasks
+ * [Arguments]: no arguments
+ * [Returns]: the time
+ */
+uint32 HMI_getTime(void);
+/* [Description]: function responsible for setting the table of the tasks of the HMI ECU for the Scheduler
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_initTasks(void);
+/* [Description]: the task of the link with the CONTROL ECU , it gives the oldest queued event to the state
+ * 				  machine , the events wait in the queue while a message is displayed
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_linkTask(void);
+/* [Description]: the task of the KeyPad , it is run every tick and scans the KeyPad except while the system
+ * 				  is locked
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_keypadTask(void);
+/* [Description]: the task of the LCD , it is run every tick and refreshes the count down of the lockout
+ * 				  and waits for the end of the displayed message without blocking the other tasks
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_lcdTask(void);
+/* [Description]: function responsible for displaying a message for a number of ticks without waiting , the
+ * 				  LCD task calls the given function when it is over
+ * [Arguments]: the message , the ticks and the function called at the end
+ * [Returns]: no return
+ */
+void HMI_showMessage(const char *a_message , uint8 a_ticks , void(*a_donePtr)(void));
+/* [Description]: function responsible for checking if a message is displayed
+ * [Arguments]: no arguments
+ * [Returns]: TRUE while the message is displayed
+ */
+bool HMI_isMessageShown(void);
+/* [Description]: function responsible for reading the ticks since the start , it is the time of the state machine
+ * [Arguments]: no arguments
+ * [Returns]: the ticks
+ */
+uint32 HMI_getTicks(void);
+/* [Description]: prototype for the call back function for the interrupt of Timer Module , it is called every tick
+ * 				  it counts the tick for the Scheduler and calls the per second call back every second
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_tickProcessing(void);
+/* [Description]: function responsible for setting the function called by the tick every second
+ * [Arguments]: the address of the function or NULL to stop calling it
+ * [Returns]: no return
+ */
+void HMI_setSecondCallBack(void(*a_ptr)(void));
+/* [Description]: prototype for the function called every second of the tick while the system is locked
+ * 				  it counts down the seconds left of the lockout and queues EVENT_LOCKOUT_OVER at the end
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_timerLockoutProcessing(void);
+/* [Description]: function responsiple for indicating if two arrays are equal or not
+ * [Arguments]: it takes two arrays addresses and the size of the array
+ * [Returns]: return 1 if the two arrays are equal
+ * 			  return 0 if the two arrays are different
+ */
+uint8 HMI_compare(uint8 *a_first , uint8 *a_second , uint8 a_arraySize);
+/* [Description]: function responsible for displaying the diplaying of main options on LCD
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_displayMainOptions(void);
+/* [Description]: function responsible for handling the pressed key on the main menu
+ * 				  '+' starts changing the password and '-' starts opening the door
+ * 				  (and KEYTRACE_REPLAY_KEY replays the recorded keys when KEYTRACE_REPLAY_ENABLE is 1 ,
+ * 				  SLEEP_STATS_KEY displays the wake ups when SLEEP_STATS_ENABLE is 1)
+ * [Arguments]: the pressed key
+ * [Returns]: no return
+ */
+void HMI_mainOptionsProcessing(uint8 a_key);
+/* [Description]: function responsible for displaying the wake ups of the sleep on the main options and the
+ * 				  seconds the MCU was awake (the tick is stopped while sleeping) then the main options
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_displaySleepStats(void);
+/* [Description]: function responsible for copying the recorded keys and replaying them into the keypad task
+ * 				  with the same gaps , the key that asked for the replay is not replayed
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_replayKeys(void);
+/* [Description]: function responsible for handling one tick in the main loop , it takes a key event from the
+ * 				  KeyPad (or from the replayed trace) and gives it to the main options or the active entry and handles the entry when it is complete or timed out
+ * 				  while the door is moving the key is used to stop the door or keep it open
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_keypadProcessing(void);
+/* [Description]: function responsible for using the typed password when the entry is complete
+ * 				  or going back when the entry is timed out depending on the purpose of the entry
+ * [Arguments]: the status returned by the entry component
+ * [Returns]: no return
+ */
+void HMI_entryProcessing(Entry_Status a_status);
+/* [Description]: the call back function of the entry component for every accepted key , it streams the typed
+ * 				  digit (or the clearing of the digits) to the CONTROL ECU while the password is typed
+ * [Arguments]: the typed digit or ENTRY_CLEAR_KEY
+ * [Returns]: no return
+ */
+void HMI_streamDigit(uint8 a_key);
+/* [Description]: function responsible for sending a command followed by all the digits of a password
+ * 				  and the end of the password to the CONTROL ECU
+ * [Arguments]: the command , the address of the password and its length
+ * [Returns]: no return
+ */
+void HMI_sendPassword(uint8 a_command , uint8 *a_passwordPtr , uint8 a_length);
+/* [Description]: function responsible for displaying a message indicating that the system is locked
+ * 				  and starting the count down of the seconds received from the CONTROL ECU
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_displayLockout(void);
+/* [Description]: function responsible for updating the count down of the lockout every tick
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_lockoutProcessing(void);
+/* [Description]: function responsible for stopping the count down and displaying the main options again
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_lockoutOver(void);
+/* [Description]: function responsible for going back to the main options when nobody typed the password
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_cancelEntry(void);
+/* [Description]: function responsible for starting the entry of the password from the KeyPad module
+ * 				  and the password is taken again if the both password are equal it is sent to the CONTROL ECU
+ * 				  to set the password this function should be called only one time at the beginning of the sysytem
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_setPassword(void);
+/* [Description]: function responsible for starting the entry of the password from the KeyPad module
+ * 				  when it is complete it is sent to the CONTROL ECU to change password
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_changePassword(void);
+/* [Description]: function responsible for starting the entry of the password from the KeyPad module
+ * 				  when it is complete it is sent to the CONTROL ECU to open the door
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_openDoor (void);
+/* [Description]: function responsible for displaying the state of the door received from the CONTROL ECU
+ * 				  while it is unlocking , open or locking
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_displayDoorState(void);
+/* [Description]: function responsible for going back to the main options when the door is locked again
+ * 				  or displaying that the door was stopped first
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_doorDone(void);
+/* [Description]: function responsible for sending the requests of the keys pressed while the door is moving
+ * [Arguments]: the key event of the KeyPad
+ * [Returns]: no return
+ */
+void HMI_doorKeyProcessing(uint8 a_key);
+/* [Description]: function responsible for displaying that the entered password is wrong
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_wrongPassword(void);
+/* [Description]: function responsible for displaying that the CONTROL ECU did not reply then the main options
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_replyTimeout(void);
+/* [Description]: function responsible for displaying the main options after the wrong password message
+ * 				  unless the system is locked
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_wrongPasswordDone(void);
+/* [Description]: function responsible for displaying that the password is set then the main options
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_passwordSet(void);
+/* [Description]: function responsible for starting the entry of the new password from the KeyPad module
+ * 				  and the password is taken again if the both password are equal it is sent to the CONTROL ECU
+ * 				  to set the new password
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_precedeChange(void);
+
+
+
+
+#endif /* HMI_ECU_DECLERATIONS_H_ */
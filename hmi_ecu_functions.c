@@ -1,507 +1,888 @@
-/*------------------------------------------------------------------------------------------------------------------------------
- *
- * [FILE NAME]:  hmi_ecu_functions
- *
- * [AUTHOR]:   Shady Ali
- *
- * [DATE] [CREATED]:  Dec 5, 2020
- *
- * [DESCRIPTION]: source file for the functions of the Human Interface ECU
- * 				  The file contain the definitions of functions for HMI_ECU and the Global variables
- *
- -----------------------------------------------------------------------------------------------------------------------------*/
-
-#include "hmi_ecu_declerations.h"
-
-/************************************************************************************************
- * 										Global Variables										*
- ***********************************************************************************************/
-
-/* global variable to indicate the received byte from the CONTROL ECU */
-volatile uint8 g_select=0;
-/* global variable to count the number of seconds for the Timer Module*/
-volatile uint8 g_numberOfSeconds=0;
-/* global variable indicating if its the first time for the system or not */
-volatile uint8 flag=0;
-/* global variable indicating if there is a pressed button */
-volatile uint8 condition=0;
-/* global variable to count how many times the password was entered wrong */
-volatile uint8 wrong_counter=0;
-
-
-
-
-/************************************************************************************************
- * 										  Function Definitions									*
- ***********************************************************************************************/
-/* [Description]: the call back function for the Receive interrupt of the UART module for HMI ECU
- * 				  it should receive the byte and set the value for g_select variable indicating the mode
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-
-void HMI_uartAppProcessing(void)
-{
-	/* variable to hold the received byte indicating which mode */
-	uint8 key =UART_receiveByte();
-	/* condition to select the mode of HMI ECU */
-	if(key == PASSWORD_IS_RIGHT)
-	{
-		g_select=1; /* set the global variable g_select to 1 if the password is right */
-	}
-	else if(key == PASSWORD_IS_WRONG)
-	{
-		g_select=2; /* set the global variable g_select to 2 if the password is wrong */
-	}
-	else if(key == PRECEDE_CHANGE)
-	{
-		/* set the global variable g_select to 3 if the sent password is right
-		 * and we can precede to change the password  */
-		g_select=3;
-	}
-	else if(key == DONT_CHANGE)
-	{
-		/* set the global variable g_select to 4 if the sent password is wrong
-		 * and we dont change the password  */
-		g_select=4;
-	}
-}
-
-/* [Description]: the call back function for the interrupt of Timer Module for the function open door for HMI ECU
- * 				  it should increment the number of seconds  and if the seconds =15 or 18
- * 				  it display a message on the LCD
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void HMI_timerOpenDoorProcessing(void)
-{
-	g_numberOfSeconds++; /* increment the global variable holding the number of seconds */
-	if(g_numberOfSeconds == 15)
-	{
-		/* if the seconds is 15 it displays that the door is open */
-		LCD_clearScreen();
-		LCD_displayString("Door is open");
-	}
-	else if(g_numberOfSeconds == 18)
-	{
-		/* if the seconds is 18 it displays that the door locking */
-		LCD_clearScreen();
-		LCD_displayString("Door is locking");
-	}
-}
-
-/* [Description]: the call back function for the interrupt of Timer Module for the function Buzzer on for HMI ECU
- * 				  it should increment the number of seconds  and if the seconds =60 it stops the buzzer
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void HMI_timerBuzzerProcessing(void)
-{
-	g_numberOfSeconds++;  /* increment the global variable holding the number of seconds */
-	if(g_numberOfSeconds == 60)
-	{
-		/* after one minute it stops the buzzer and displays main options */
-		HMI_buzzerOff();
-	}
-}
-
-/* [Description]: function responsible for indicating if two arrays are equal or not
- * [Arguments]: it takes two arrays addresses and the size of the array
- * [Returns]: return 1 if the two arrays are equal
- * 			  return 0 if the two arrays are different
- */
-uint8 HMI_compare(uint8 *a_first , uint8 *a_second , uint8 a_arraySize)
-{
-	uint8 i=0; /* incremental variable for the for loop */
-	for(i=0;i< a_arraySize;i++)
-	{
-		/* condition to compare each elements of the two arrays */
-		if(a_first[i] != a_second[i])
-		{
-			return 0;
-		}
-	}
-	return 1;
-}
-
-/* [Description]: function responsible for displaying the diplaying of main options on LCD
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void HMI_displayMainOptions(void)
-{
-	LCD_clearScreen();
-	LCD_displayString("+ : Change Pass");
-	LCD_goToRowColumn(1,0);
-	LCD_displayString("- : Open Door");
-}
-
-/* [Description]: function responsible for displaying a message indicating that the system is locked
- * 				  it should display the message for one minute using TIMER module
- * [Arguments]: it takes a structure of type Timer_ConfigType to initialize the timer
- * [Returns]: no return
- */
-void HMI_buzzerOnForOneMinute(Timer_ConfigType *Timer_ConfigPtr)
-{
-	/* initialize the Timer and pass the structure holding the required information */
-	TIMER_init(Timer_ConfigPtr);
-	TIMER_setCallBack(HMI_timerBuzzerProcessing); /* set the call back function for the Timer module */
-	g_numberOfSeconds=0;
-	/* display the message indicating that there is a thief */
-	LCD_clearScreen();
-	LCD_displayString("System is Locked");
-	LCD_goToRowColumn(1,0);
-	LCD_displayString("catch thief!!!");
-	while(g_numberOfSeconds != 60); /* polling for one minute */
-
-}
-
-/* [Description]: function responsible for turning the buzzer of an display the main options again
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-void HMI_buzzerOff(void)
-{
-	HMI_displayMainOptions();
-}
-
-/* [Description]: function responsible for taking the password from the KeyPad module
- * 				  and take the password again if the both password are equal send to the CONTROL ECU
- * 				  to set the password and send the password this function should display only one
- * 				  time at the beginning of the sysytem
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-
-void HMI_setPassword(void)
-{
-	/* key variable to hold the pressed key from the key pad
-	 * i variable is the incremental variable for the for loops
-	 */
-	uint8 i=0,key;
-	/* an array to hold the entered password for the first time */
-	uint8 password[5];
-	/* an array to hold the entered password for the second time */
-	uint8 password2[5];
-	LCD_clearScreen();
-	do
-	{
-		LCD_clearScreen();
-		LCD_displayString("Enter New Pass:"); /* display a message to enter the password */
-		LCD_goToRowColumn(1,6);
-		for(i=0;i<5;i++)
-		{
-			key=KeyPad_getPressedKey();
-			if((key >= 0) && (key <= 9))
-			{
-				/* if the pressed key is a number store it in the password array */
-				password[i]=key;
-				LCD_displayCharacter('*');
-				_delay_ms(350);
-			}
-			else if(key==13)
-			{
-				/* if the pressed key is 'enter' repeat the process from the beginning*/
-				i=-1;
-				LCD_clearScreen();
-				LCD_displayString("Enter New Pass:");
-				LCD_goToRowColumn(1,6);
-				continue;
-			}
-			else
-			{
-				/* if the pressed key is not a number or 'enter' dont store it */
-				i -=1;
-				continue;
-			}
-		}
-		LCD_clearScreen();
-		_delay_ms(700);
-		LCD_displayString("Enter Pass again:"); /* display a message to enter the password for the second time */
-		LCD_goToRowColumn(1,6);
-		key=0;
-		/* loop for taking the password for the second time */
-		for(i=0;i<5;i++)
-		{
-			key=KeyPad_getPressedKey();
-			if((key >= 0) && (key <= 9))
-			{
-				/* if the pressed key is a number store it in the second password array */
-				password2[i]=key;
-				LCD_displayCharacter('*');
-				_delay_ms(350);
-			}
-			else if(key==13)
-			{
-				/* if the pressed key is 'enter' repeat the process from the beginning*/
-				i= -1;
-				LCD_clearScreen();
-				LCD_displayString("Enter Pass again:");
-				LCD_goToRowColumn(1,6);
-				continue;
-			}
-			else
-			{
-				/* if the pressed key is not a number or 'enter' dont store it */
-				i -=1;
-				continue;
-			}
-		} /* compare between the two password if they are equal get out off the loop
-			*  and if not continue in the loop */
-	}while(HMI_compare(password,password2 , 5) == 0);
-	LCD_clearScreen();
-	LCD_displayString("Password is set");
-	_delay_ms(700);
-	/* write one byte to the internal EEPROM of the HMI ECU to indicate that the password is set
-	 * to not repeat this function again
-	 */
-	eeprom_write_byte(FIRST_TIME_ADDRESS, 0x05);
-	/* set the flag variable to one so this function do not be repeated */
-	flag = 1;
-	/* send one byte to the CONTROL ECU indicating to store a new password */
-	UART_sendByte(NEW_PASSWORD);
-	/* send the password to the CONTROL ECU */
-	UART_sendArray(password , 5);
-}
-
-/* [Description]: function responsible for taking the password from the KeyPad module
- * 				  and send to the CONTROL ECU to change password then send the password
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-
-void HMI_changePassword(void)
-{
-	/* an array to hold the entered password  */
-	uint8 password[5];
-	/* key variable to hold the pressed key from the key pad
-	 * i variable is the incremental variable for the for loops
-	 */
-	uint8 key=0 , i=0;
-	/* set the global variable condition to 1 indicating that the password has been sent */
-	condition=1;
-	LCD_clearScreen();
-	LCD_displayString("Enter Password:"); /* display message to enter the password */
-	LCD_goToRowColumn(1,6);
-	for(i=0;i<5;i++)
-	{
-		/* if the pressed key is a number store it in the second password array */
-		key=KeyPad_getPressedKey();
-		if((key >= 0) && (key <= 9))
-		{
-			password[i]=key;
-			LCD_displayCharacter('*');
-			_delay_ms(350);
-		}
-		else if(key==13)
-		{
-			/* if the pressed key is 'enter' repeat the process from the beginning*/
-			i= -1;
-			LCD_clearScreen();
-			LCD_displayString("Enter current Pass:");
-			LCD_goToRowColumn(1,6);
-			continue;
-		}
-		else
-		{
-			/* if the pressed key is not a number or 'enter' dont store it */
-			i -=1;
-			continue;
-		}
-	}
-	/* send one byte to the Control ECU  indicating to change the password */
-	UART_sendByte(CHANGE_PASSWORD);
-	/* send the password to the Control ECU */
-	UART_sendArray(password , 5);
-}
-
-/* [Description]: function responsible for taking the password from the KeyPad module
- * 				  and send to the CONTROL ECU to open the door then send the password
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-
-void HMI_openDoor (void)
-{
-	/* an array to hold the entered password  */
-	uint8 password[5];
-	/* key variable to hold the pressed key from the key pad
-	 * i variable is the incremental variable for the for loops
-	 */
-	uint8 key , i;
-	/* set the global variable condition to 1 indicating that the password has been sent */
-	condition=1;
-	LCD_clearScreen();
-	LCD_displayString("Enter Password:"); /* display message to enter the password */
-	LCD_goToRowColumn(1,6);
-	for(i=0;i<5;i++)
-	{
-		/* if the pressed key is a number store it in the second password array */
-		key=KeyPad_getPressedKey();
-		if((key >= 0) && (key <= 9))
-		{
-			password[i]=key;
-			LCD_displayCharacter('*');
-			_delay_ms(350);
-		}
-		else if(key==13)
-		{
-			/* if the pressed key is 'enter' repeat the process from the beginning*/
-			i=-1;
-			LCD_clearScreen();
-			LCD_displayString("Enter Password:");
-			LCD_goToRowColumn(1,6);
-			continue;
-		}
-		else
-		{
-			/* if the pressed key is 'enter' repeat the process from the beginning*/
-			i -=1;
-			continue;
-		}
-	}
-	/* send one byte to the Control ECU  indicating to open the door */
-	UART_sendByte(OPEN_DOOR);
-	/* send the password to the Control ECU */
-	UART_sendArray(password , 5);
-}
-
-/* [Description]: function responsible for initializing the TIMER module and displaying the open door messages
- * [Arguments]: a structure of typr Timer_ConfigType
- * [Returns]: no return
- */
-void HMI_displayOpenDoor(Timer_ConfigType *Timer_ConfigPtr)
-{
-	/* set the global variable g_select to 0 indicating that the operation has been done*/
-	g_select=0;
-	TIMER_init(Timer_ConfigPtr); /* initializing Timer with the required information */
-	g_numberOfSeconds=0;
-	TIMER_setCallBack(HMI_timerOpenDoorProcessing); /*set the call back function of the TIMER */
-	LCD_clearScreen();
-	LCD_displayString("Door is ");
-	LCD_goToRowColumn(1,0);
-	LCD_displayString("Unlocking");
-	while(g_numberOfSeconds != 33); /* polling for the required time for the door to open and close */
-	TIMER_stop(Timer_ConfigPtr->timer); /* stopping the Timer */
-	g_numberOfSeconds=0;
-	condition=0;
-}
-
-/* [Description]: function responsible for initializing the TIMER module and displaying
- * 				  that the entered password is wrong if the entered password is wrong for 3 times
- * 				  it should turn on the Buzzer
- * [Arguments]: a structure of type Timer_ConfigType
- * [Returns]: no return
- */
-void HMI_wrongPassword(Timer_ConfigType *Timer_ConfigPtr)
-{
-	g_select=0;
-	wrong_counter++;
-	LCD_clearScreen();
-	LCD_displayString("Wrong Password");
-	_delay_ms(1000);
-	if(wrong_counter==3)
-	{
-		HMI_buzzerOnForOneMinute(Timer_ConfigPtr);
-		g_numberOfSeconds=0;
-		wrong_counter=0;
-		condition=0;
-	}
-	condition=0;
-}
-
-/* [Description]: function responsible for taking the password from the KeyPad module
- * 				  and take the password again if the both password are equal send to the CONTROL ECU
- * 				  to set the new password and send the password
- * [Arguments]: no arguments
- * [Returns]: no return
- */
-
-void HMI_precedeChange(void)
-{
-	/* key variable to hold the pressed key from the key pad
-	 * i variable is the incremental variable for the for loops
-	 */
-	uint8 i=0,key;
-	/* an array to hold the entered password for the first time */
-	uint8 password[5];
-	/* an array to hold the entered password for the second time */
-	uint8 password2[5];
-	g_select=0;
-	LCD_clearScreen();
-	do
-	{
-		LCD_clearScreen();
-		LCD_displayString("Enter New Pass:");/* display a message to enter the new password */
-		LCD_goToRowColumn(1,6);
-		for(i=0;i<5;i++)
-		{
-			key=KeyPad_getPressedKey();
-			if((key >= 0) && (key <= 9))
-			{
-				/* if the pressed key is a number store it in the password array */
-				password[i]=key;
-				LCD_displayCharacter('*');
-				_delay_ms(350);
-			}
-			else if(key==13)
-			{
-				/* if the pressed key is 'enter' repeat the process from the beginning*/
-				i=-1;
-				LCD_clearScreen();
-				LCD_displayString("Enter New Pass:");
-				LCD_goToRowColumn(1,6);
-				continue;
-			}
-			else
-			{
-				/* if the pressed key is not a number or 'enter' dont store it */
-				i -=1;
-				continue;
-			}
-		}
-		LCD_clearScreen();
-		_delay_ms(700);
-		LCD_displayString("Enter Pass again:");/* display a message to enter the password for the second time */
-		LCD_goToRowColumn(1,6);
-		key=0;
-		/* loop for taking the password for the second time */
-		for(i=0;i<5;i++)
-		{
-			key=KeyPad_getPressedKey();
-			if((key >= 0) && (key <= 9))
-			{
-				/* if the pressed key is a number store it in the password array */
-				password2[i]=key;
-				LCD_displayCharacter('*');
-				_delay_ms(550);
-			}
-			else if(key==13)
-			{
-				/* if the pressed key is 'enter' repeat the process from the beginning*/
-				i=-1;
-				LCD_clearScreen();
-				LCD_displayString("Enter Pass again:");
-				LCD_goToRowColumn(1,6);
-				continue;
-			}
-			else
-			{
-				/* if the pressed key is not a number or 'enter' dont store it */
-				i -=1;
-				continue;
-			}
-		}
-		/* compare between the two password if they are equal get out off the loop
-		 *  and if not continue in the loop */
-	}while(HMI_compare(password,password2 , 5) == 0);
-	LCD_clearScreen();
-	LCD_displayString("Password is set");
-	_delay_ms(700);
-	/* send one byte to the CONTROL ECU indicating that the password is changed */
-	UART_sendByte(PASSWORD_IS_CHANGED);
-	/* send the password to the CONTROL ECU */
-	UART_sendArray(password , 5);
-	condition=0;
-}
-
+/*------------------------------------------------------------------------------------------------------------------------------
+ *
+ * [FILE NAME]:  hmi_ecu_functions
+ *
+ * [AUTHOR]:   Shady Ali
+ *
+ * [DATE] [CREATED]:  Dec 5, 2020
+ *
+ * [DESCRIPTION]: source file for the functions of the Human Interface ECU
+ * 				  The file contain the definitions of functions for HMI_ECU and the Global variables
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+
+#include "hmi_ecu_declerations.h"
+#include<stdio.h>
+#include<stdlib.h>
+#include<avr/pgmspace.h>
+
+/************************************************************************************************
+ * 										Global Variables										*
+ ***********************************************************************************************/
+
+/* global variable holding the seconds left of the lockout received from the CONTROL ECU */
+volatile uint16 g_lockoutSeconds=0;
+/* global variable holding the last state of the door received from the CONTROL ECU */
+volatile uint8 g_doorState=DOOR_LOCKED;
+
+/* variable to hold the address of the function called by the tick every second */
+static void (*volatile g_secondCallBackPtr) (void)=NULL;
+/* variable to count the ticks of the current second */
+static volatile uint8 g_ticksOfSecond=0;
+/* variable holding the seconds of the lockout displayed on the LCD */
+static uint16 g_displayedSeconds=0;
+/* variable holding what the typed password will be used for */
+static HMI_EntryPurpose g_entryPurpose;
+/* an array to hold the entered password for the first time while it is entered again */
+static uint8 g_firstPassword[PIN_MAX_LENGTH];
+/* number of digits of the password entered for the first time */
+static uint8 g_firstPasswordLength;
+/* the statistics of the stages of opening the door */
+Latency_StatType g_latency[LATENCY_STAGES];
+/* the times of the last key and of sending the end of the password */
+static uint32 g_keyTime=0;
+static uint32 g_sentTime=0;
+/* flags set from sending the end of the password until the reply is received and then displayed */
+static volatile bool g_waitingReply=FALSE;
+static volatile bool g_displayPending=FALSE;
+/* the command that opens the session of the typed password on the CONTROL ECU , it is sent with the first
+ * digit and cleared , 0 when the session is open */
+static uint8 g_sessionCommand=0;
+/* the events queued by the UART and the Timer interrupts for the main loop */
+static uint8 g_eventBuffer[EVENT_QUEUE_SIZE];
+static Queue_Type g_eventQueue=QUEUE_INITIALIZER(g_eventBuffer);
+/* the ticks since the start */
+static volatile uint32 g_ticks=0;
+/* the ticks spent in every state */
+static uint32 g_stateTicks[HMI_STATES];
+/* the ticks left of the displayed message and the function called when it is over */
+static volatile uint8 g_messageTicks=0;
+static void (*g_messageDonePtr) (void)=NULL;
+#if KEYTRACE_REPLAY_ENABLE
+/* the copy of the recorded keys being replayed , the recorder goes on while replaying */
+static Keytrace_RecordType g_replayTrace[KEYTRACE_SIZE];
+#endif
+
+/* the table of the tasks of the HMI ECU , the link runs in every pass of the main loop and the keypad and
+ * the LCD every tick : the task , the period , the ticks left , the run time and the runs (set by SCHED_init) */
+static Sched_TaskType g_hmiTasks[HMI_TASKS]=
+{
+	{HMI_linkTask , 0 , 0 , 0 , 0} , {HMI_keypadTask , 1 , 1 , 0 , 0} , {HMI_lcdTask , 1 , 1 , 0 , 0}
+};
+
+/* the transition table of the HMI ECU , one row for every state and one column for every event */
+static const Fsm_TransitionType g_hmiTable[HMI_STATES*HMI_EVENTS] PROGMEM=
+{
+	/* HMI_SETUP */
+	FSM_IGNORED , FSM_IGNORED , FSM_IGNORED , {HMI_MENU , HMI_passwordSet} ,
+	{HMI_SETUP , HMI_setPassword} , FSM_IGNORED , FSM_IGNORED , {HMI_LOCKED , HMI_displayLockout} ,
+	FSM_IGNORED , FSM_IGNORED , FSM_IGNORED , FSM_IGNORED ,
+	/* HMI_MENU */
+	{HMI_TYPING , HMI_changePassword} , {HMI_TYPING , HMI_openDoor} , FSM_IGNORED , FSM_IGNORED ,
+	FSM_IGNORED , FSM_IGNORED , FSM_IGNORED , {HMI_LOCKED , HMI_displayLockout} ,
+	FSM_IGNORED , {HMI_DOOR , HMI_displayDoorState} , FSM_IGNORED , FSM_IGNORED ,
+	/* HMI_TYPING */
+	FSM_IGNORED , FSM_IGNORED , {HMI_WAITING , NULL} , {HMI_MENU , HMI_passwordSet} ,
+	{HMI_MENU , HMI_cancelEntry} , FSM_IGNORED , FSM_IGNORED , {HMI_LOCKED , HMI_displayLockout} ,
+	FSM_IGNORED , FSM_IGNORED , FSM_IGNORED , FSM_IGNORED ,
+	/* HMI_WAITING */
+	FSM_IGNORED , FSM_IGNORED , FSM_IGNORED , FSM_IGNORED ,
+	FSM_IGNORED , {HMI_MENU , HMI_wrongPassword} , {HMI_TYPING , HMI_precedeChange} , {HMI_LOCKED , HMI_displayLockout} ,
+	FSM_IGNORED , {HMI_DOOR , HMI_displayDoorState} , FSM_IGNORED , {HMI_MENU , HMI_replyTimeout} ,
+	/* HMI_LOCKED */
+	FSM_IGNORED , FSM_IGNORED , FSM_IGNORED , FSM_IGNORED ,
+	FSM_IGNORED , FSM_IGNORED , FSM_IGNORED , {HMI_LOCKED , HMI_displayLockout} ,
+	{HMI_MENU , HMI_lockoutOver} , FSM_IGNORED , FSM_IGNORED , FSM_IGNORED ,
+	/* HMI_DOOR */
+	FSM_IGNORED , FSM_IGNORED , FSM_IGNORED , FSM_IGNORED ,
+	FSM_IGNORED , FSM_IGNORED , FSM_IGNORED , {HMI_LOCKED , HMI_displayLockout} ,
+	FSM_IGNORED , {HMI_DOOR , HMI_displayDoorState} , {HMI_MENU , HMI_doorDone} , FSM_IGNORED
+};
+
+/* the state machine of the HMI ECU , it is started by the main function */
+Fsm_Type g_hmiFsm={g_hmiTable , HMI_EVENTS , HMI_getTicks , g_stateTicks , NULL , HMI_SETUP , 0};
+
+
+/************************************************************************************************
+ * 										  Function Definitions									*
+ ***********************************************************************************************/
+/* [Description]: the call back function for the Receive interrupt of the UART module for HMI ECU
+ * 				  it should receive the byte and queue the event of the message for the main loop
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+
+void HMI_uartAppProcessing(void)
+{
+	/* the message whose bytes are being received and the number of its bytes left */
+	static uint8 s_message = 0;
+	static uint8 s_bytesLeft = 0;
+	/* the seconds of the lockout being received , they are given to the tick only when complete */
+	static uint16 s_seconds = 0;
+	/* variable to hold the received byte indicating which mode */
+	uint8 key =UART_receiveByte();
+	if(g_waitingReply == TRUE)
+	{
+		/* the first byte of the reply to the sent password */
+		g_waitingReply=FALSE;
+		g_displayPending=TRUE;
+		LATENCY_record(&g_latency[LATENCY_ROUND_TRIP] , HMI_getTime() - g_sentTime);
+	}
+	if(s_bytesLeft > 0)
+	{
+		s_bytesLeft--;
+		if(s_message == DOOR_STATE)
+		{
+			QUEUE_put(&g_eventQueue , EVENT_DOOR_STATE + key);
+		}
+		else
+		{
+			/* the seconds of the lockout are received high byte first */
+			s_seconds = (s_seconds << 8) | key;
+			if(s_bytesLeft == 0)
+			{
+				g_lockoutSeconds = s_seconds;
+				QUEUE_put(&g_eventQueue , EVENT_SYSTEM_LOCKED);
+			}
+		}
+		return;
+	}
+	/* condition to select the event of the message */
+	if(key == SYSTEM_LOCKED)
+	{
+		s_seconds=0;
+		s_message=key;
+		s_bytesLeft=2;
+	}
+	else if(key == DOOR_STATE)
+	{
+		s_message=key;
+		s_bytesLeft=1;
+	}
+	/* PASSWORD_IS_RIGHT is followed by the states of the door that display the opening */
+	else if((key == PASSWORD_IS_WRONG) || (key == DONT_CHANGE))
+	{
+		/* the sent password is wrong so the door is not opened or the password is not changed */
+		QUEUE_put(&g_eventQueue , EVENT_PASSWORD_WRONG);
+	}
+	else if(key == PRECEDE_CHANGE)
+	{
+		/* the sent password is right and we can precede to change the password */
+		QUEUE_put(&g_eventQueue , EVENT_PRECEDE_CHANGE);
+	}
+}
+
+/* [Description]: function responsible for taking the oldest event queued by the interrupts for the main loop
+ * 				  a state of the door is kept for the display and given as EVENT_DOOR_MOVING or EVENT_DOOR_DONE
+ * [Arguments]: no arguments
+ * [Returns]: the event or EVENT_NONE if there is no event
+ */
+uint8 HMI_getEvent(void)
+{
+	uint8 event;
+	if(QUEUE_get(&g_eventQueue , &event) == FALSE)
+	{
+		return EVENT_NONE;
+	}
+	if(event >= EVENT_DOOR_STATE)
+	{
+		g_doorState = event - EVENT_DOOR_STATE;
+		if((g_doorState == DOOR_LOCKED) || (g_doorState == DOOR_FAULT))
+		{
+			event = EVENT_DOOR_DONE;
+		}
+		else
+		{
+			event = EVENT_DOOR_MOVING;
+		}
+	}
+	return event;
+}
+
+/* [Description]: function responsible for checking if the interrupts queued an event without taking it
+ * 				  so it can be called with the interrupts disabled before sleeping
+ * [Arguments]: no arguments
+ * [Returns]: TRUE if there is an event
+ */
+bool HMI_isEventPending(void)
+{
+	return (QUEUE_isEmpty(&g_eventQueue) == FALSE);
+}
+
+/* [Description]: function responsible for reading the time since the start in counts of Timer 1 (1 us) , it is
+ * 				  the time of the run time of the tasks , a tick that is due but not counted yet is added
+ * [Arguments]: no arguments
+ * [Returns]: the time
+ */
+uint32 HMI_getTime(void)
+{
+	uint32 ticks;
+	uint16 counts;
+	uint8 sreg = SREG;
+	cli();
+	ticks = g_ticks;
+	counts = TCNT1;
+	if(BIT_IS_SET(TIFR,OCF1A) && (counts < (TICK_COMPARE_VALUE/2)))
+	{
+		ticks++;
+	}
+	SREG = sreg;
+	return (ticks * (TICK_COMPARE_VALUE + 1)) + counts;
+}
+
+/* [Description]: function responsible for setting the table of the tasks of the HMI ECU for the Scheduler
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_initTasks(void)
+{
+	SCHED_init(g_hmiTasks , HMI_TASKS , HMI_getTime);
+}
+
+/* [Description]: the task of the link with the CONTROL ECU , it gives the oldest queued event to the state
+ * 				  machine , the events wait in the queue while a message is displayed , when nothing is
+ * 				  received for HMI_REPLY_TIMEOUT_TICKS in HMI_WAITING it gives EVENT_REPLY_TIMEOUT
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_linkTask(void)
+{
+	uint8 event;
+	/* the times before and after the event is given to the state machine */
+	uint32 start;
+	uint32 end;
+	if(g_messageTicks != 0)
+	{
+		return;
+	}
+	event = HMI_getEvent();
+	if(event != EVENT_NONE)
+	{
+		start = HMI_getTime();
+		FSM_dispatch(&g_hmiFsm , event);
+		if((g_displayPending == TRUE) && (event != EVENT_LOCKOUT_OVER))
+		{
+			/* the reply to the sent password is displayed */
+			g_displayPending=FALSE;
+			end = HMI_getTime();
+			LATENCY_record(&g_latency[LATENCY_DISPLAY] , end - start);
+			LATENCY_record(&g_latency[LATENCY_TOTAL] , end - g_keyTime);
+		}
+	}
+	else if((FSM_getState(&g_hmiFsm) == HMI_WAITING)
+			&& (FSM_getTimeInState(&g_hmiFsm) >= HMI_REPLY_TIMEOUT_TICKS))
+	{
+		/* the reply is lost , a late one is taken as a message and not as the reply */
+		g_waitingReply=FALSE;
+		g_displayPending=FALSE;
+		FSM_dispatch(&g_hmiFsm , EVENT_REPLY_TIMEOUT);
+	}
+}
+
+/* [Description]: the task of the KeyPad , it is run every tick and scans the KeyPad except while the system
+ * 				  is locked
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_keypadTask(void)
+{
+	if(FSM_getState(&g_hmiFsm) != HMI_LOCKED)
+	{
+		HMI_keypadProcessing();
+	}
+}
+
+/* [Description]: the task of the LCD , it is run every tick and refreshes the count down of the lockout
+ * 				  and waits for the end of the displayed message without blocking the other tasks
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_lcdTask(void)
+{
+	static Sched_PtType s_pt=0;
+	if(FSM_getState(&g_hmiFsm) == HMI_LOCKED)
+	{
+		HMI_lockoutProcessing();
+	}
+	PT_BEGIN(s_pt);
+	PT_WAIT_UNTIL(s_pt , g_messageTicks != 0);
+	do
+	{
+		PT_YIELD(s_pt);
+		g_messageTicks--;
+	}while(g_messageTicks != 0);
+	if(g_messageDonePtr != NULL)
+	{
+		(*g_messageDonePtr)();
+	}
+	PT_END(s_pt);
+}
+
+/* [Description]: function responsible for displaying a message for a number of ticks without waiting , the
+ * 				  LCD task calls the given function when it is over
+ * [Arguments]: the message , the ticks and the function called at the end
+ * [Returns]: no return
+ */
+void HMI_showMessage(const char *a_message , uint8 a_ticks , void(*a_donePtr)(void))
+{
+	LCD_clearScreen();
+	LCD_displayString(a_message);
+	g_messageDonePtr = a_donePtr;
+	g_messageTicks = a_ticks;
+}
+
+/* [Description]: function responsible for checking if a message is displayed
+ * [Arguments]: no arguments
+ * [Returns]: TRUE while the message is displayed
+ */
+bool HMI_isMessageShown(void)
+{
+	return (g_messageTicks != 0);
+}
+
+/* [Description]: function responsible for reading the ticks since the start , it is the time of the state machine
+ * 				  the tick is stopped while the MCU sleeps on the main options so the sleep is not counted
+ * [Arguments]: no arguments
+ * [Returns]: the ticks
+ */
+uint32 HMI_getTicks(void)
+{
+	uint32 ticks;
+	uint8 sreg = SREG;
+	cli();
+	ticks = g_ticks;
+	SREG = sreg;
+	return ticks;
+}
+
+/* [Description]: function called every second of the tick while the system is locked
+ * 				  it counts down the seconds left of the lockout and queues EVENT_LOCKOUT_OVER at the end
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_timerLockoutProcessing(void)
+{
+	if(g_lockoutSeconds > 0)
+	{
+		g_lockoutSeconds--;
+		if(g_lockoutSeconds == 0)
+		{
+			QUEUE_put(&g_eventQueue , EVENT_LOCKOUT_OVER);
+		}
+	}
+}
+
+/* [Description]: function responsible for indicating if two arrays are equal or not
+ * [Arguments]: it takes two arrays addresses and the size of the array
+ * [Returns]: return 1 if the two arrays are equal
+ * 			  return 0 if the two arrays are different
+ */
+uint8 HMI_compare(uint8 *a_first , uint8 *a_second , uint8 a_arraySize)
+{
+	uint8 i=0; /* incremental variable for the for loop */
+	for(i=0;i< a_arraySize;i++)
+	{
+		/* condition to compare each elements of the two arrays */
+		if(a_first[i] != a_second[i])
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/* [Description]: function responsible for displaying the diplaying of main options on LCD
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_displayMainOptions(void)
+{
+	LCD_clearScreen();
+	LCD_displayString("+ : Change Pass");
+	LCD_goToRowColumn(1,0);
+	LCD_displayString("- : Open Door");
+}
+
+/* [Description]: function responsible for displaying a message indicating that the system is locked
+ * 				  and starting the count down of the seconds received from the CONTROL ECU
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_displayLockout(void)
+{
+	g_displayedSeconds=0;
+	HMI_setSecondCallBack(HMI_timerLockoutProcessing); /* count down the seconds with the tick */
+	/* display the message indicating that there is a thief */
+	LCD_clearScreen();
+	LCD_displayString("System is Locked");
+}
+
+/* [Description]: function responsible for updating the count down of the lockout every tick
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_lockoutProcessing(void)
+{
+	uint16 seconds;
+	/* the seconds are changed by the tick so read them with the interrupts disabled */
+	cli();
+	seconds = g_lockoutSeconds;
+	sei();
+	if((seconds != 0) && (seconds != g_displayedSeconds))
+	{
+		/* display the seconds left only when they change */
+		g_displayedSeconds = seconds;
+		LCD_goToRowColumn(1,0);
+		LCD_displayString("Wait ");
+		LCD_intgerToString(seconds);
+		LCD_displayString(" sec   ");
+	}
+}
+
+/* [Description]: function responsible for stopping the count down and displaying the main options again
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_lockoutOver(void)
+{
+	HMI_setSecondCallBack(NULL);
+	HMI_displayMainOptions();
+}
+
+/* [Description]: the call back function for the interrupt of Timer Module , it is called every tick
+ * 				  it counts the tick for the Scheduler and calls the per second call back every second
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_tickProcessing(void)
+{
+	SCHED_tick();
+	g_ticks++;
+	g_ticksOfSecond++;
+	if(g_ticksOfSecond == TICKS_PER_SECOND)
+	{
+		g_ticksOfSecond=0;
+		if(g_secondCallBackPtr != NULL)
+		{
+			(*g_secondCallBackPtr)();
+		}
+	}
+}
+
+/* [Description]: function responsible for setting the function called by the tick every second
+ * [Arguments]: the address of the function or NULL to stop calling it
+ * [Returns]: no return
+ */
+void HMI_setSecondCallBack(void(*a_ptr)(void))
+{
+	g_ticksOfSecond=0;
+	g_secondCallBackPtr = a_ptr;
+}
+
+/* [Description]: function responsible for handling the pressed key on the main menu
+ * 				  '+' starts changing the password and '-' starts opening the door
+ * 				  (and KEYTRACE_REPLAY_KEY replays the recorded keys when KEYTRACE_REPLAY_ENABLE is 1 ,
+ * 				  SLEEP_STATS_KEY displays the wake ups when SLEEP_STATS_ENABLE is 1)
+ * [Arguments]: the pressed key
+ * [Returns]: no return
+ */
+void HMI_mainOptionsProcessing(uint8 a_key)
+{
+	if(a_key == '+')
+	{
+		/* if the pressed key is '+' start changing the password */
+		FSM_dispatch(&g_hmiFsm , EVENT_CHANGE_KEY);
+	}
+	else if(a_key == '-')
+	{
+		/* if the pressed key is '-' start opening the door  */
+		FSM_dispatch(&g_hmiFsm , EVENT_OPEN_KEY);
+	}
+#if KEYTRACE_REPLAY_ENABLE
+	else if((a_key == KEYTRACE_REPLAY_KEY) && (KEYTRACE_isReplaying() == FALSE))
+	{
+		HMI_replayKeys();
+	}
+#endif
+#if SLEEP_STATS_ENABLE
+	else if(a_key == SLEEP_STATS_KEY)
+	{
+		HMI_displaySleepStats();
+	}
+#endif
+}
+
+/* [Description]: function responsible for displaying the wake ups of the sleep on the main options and the
+ * 				  seconds the MCU was awake (the tick is stopped while sleeping) then the main options
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_displaySleepStats(void)
+{
+	/* the text of a 32-bit number */
+	char text[11];
+	HMI_showMessage("Wake ups:" , 2*TICKS_PER_SECOND , HMI_displayMainOptions);
+	ultoa(KeyPad_getWakeUpCount() , text , 10);
+	LCD_displayString(text);
+	LCD_goToRowColumn(1,0);
+	LCD_displayString("Awake s:");
+	ultoa(HMI_getTicks() / TICKS_PER_SECOND , text , 10);
+	LCD_displayString(text);
+}
+
+/* [Description]: function responsible for copying the recorded keys and replaying them into the keypad task
+ * 				  with the same gaps , the key that asked for the replay is not replayed
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_replayKeys(void)
+{
+#if KEYTRACE_REPLAY_ENABLE
+	uint8 length = KEYTRACE_getRecords(g_replayTrace);
+	if(length > 0)
+	{
+		/* the last record is the key that asked for the replay */
+		length--;
+	}
+	if(length > 0)
+	{
+		/* the first key is replayed at once , its gap is from a key before the session */
+		g_replayTrace[0].gapTicks = 0;
+	}
+	KEYTRACE_startReplay(g_replayTrace , length , HMI_getTicks());
+#endif
+}
+
+/* [Description]: function responsible for handling one tick in the main loop , it takes a key event from the
+ * 				  KeyPad (or from the replayed trace) and gives it to the main options or the active entry and handles the entry
+ * 				  when it is complete or timed out , while the door is moving the key is used to stop the door
+ * 				  or keep it open , every key of the KeyPad is recorded in the key trace
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_keypadProcessing(void)
+{
+	uint8 key;
+	Entry_Status status;
+	if(KEYTRACE_isReplaying() == TRUE)
+	{
+		key = KEYTRACE_replayKey(HMI_getTicks());
+		if((key != KEYTRACE_NO_KEY) && (FSM_getState(&g_hmiFsm) == HMI_MENU) && (ENTRY_isActive() == FALSE))
+		{
+			/* the main loop does not sleep while replaying so the keys of the main options come from here */
+			HMI_mainOptionsProcessing(key);
+			return;
+		}
+	}
+	else
+	{
+		key = KeyPad_getKeyEvent();
+		if(key != KEYPAD_NO_KEY)
+		{
+			/* only the keys of the KeyPad are recorded so a replay does not overwrite the trace */
+			KEYTRACE_record(key , HMI_getTicks());
+		}
+	}
+	if((key != KEYPAD_NO_KEY) && (FSM_getState(&g_hmiFsm) == HMI_MENU) && (ENTRY_isActive() == FALSE)
+			&& (HMI_isMessageShown() == FALSE))
+	{
+		/* the keys of the main options , the key that woke the MCU up from the sleep is reported here too */
+		HMI_mainOptionsProcessing(key);
+		return;
+	}
+	if(FSM_getState(&g_hmiFsm) == HMI_DOOR)
+	{
+		/* the keys control the door while it is moving */
+		HMI_doorKeyProcessing(key);
+		return;
+	}
+	if(key != KEYPAD_NO_KEY)
+	{
+		g_keyTime = HMI_getTime();
+		status = ENTRY_feedKey(key);
+	}
+	else
+	{
+		status = ENTRY_tick();
+	}
+	HMI_entryProcessing(status);
+}
+
+/* [Description]: function responsible for using the typed password when the entry is complete
+ * 				  or going back when the entry is timed out depending on the purpose of the entry
+ * [Arguments]: the status returned by the entry component
+ * [Returns]: no return
+ */
+void HMI_entryProcessing(Entry_Status a_status)
+{
+	/* an array to hold the typed password */
+	uint8 password[PIN_MAX_LENGTH];
+	/* number of the typed digits */
+	uint8 length;
+	if(a_status == ENTRY_TIMEOUT)
+	{
+		/* the password is asked again on the setup or the main options are displayed again */
+		FSM_dispatch(&g_hmiFsm , EVENT_ENTRY_TIMEOUT);
+		return;
+	}
+	if(a_status != ENTRY_COMPLETE)
+	{
+		return;
+	}
+	length = ENTRY_getPin(password);
+	switch(g_entryPurpose)
+	{
+	case ENTER_NEW_PASSWORD:
+	case ENTER_CHANGED_PASSWORD:
+		/* keep the password and take it again */
+		g_firstPasswordLength = ENTRY_getPin(g_firstPassword);
+		g_entryPurpose++; /* the confirmation follows each entry in HMI_EntryPurpose */
+		ENTRY_start("Enter Pass again:");
+		break;
+	case CONFIRM_NEW_PASSWORD:
+	case CONFIRM_CHANGED_PASSWORD:
+		/* compare between the two password if they are not equal take them again */
+		if((length != g_firstPasswordLength) || (HMI_compare(password,g_firstPassword , length) == 0))
+		{
+			g_entryPurpose--;
+			ENTRY_start("Enter New Pass:");
+			break;
+		}
+		if(g_entryPurpose == CONFIRM_NEW_PASSWORD)
+		{
+			/* write one byte to the internal EEPROM of the HMI ECU to indicate that the password is set
+			 * to not repeat this function again , the byte is only written if it is not set already
+			 */
+			eeprom_update_byte(FIRST_TIME_ADDRESS, 0x05);
+			/* send the password to the CONTROL ECU indicating to store a new password */
+			HMI_sendPassword(NEW_PASSWORD , password , length);
+		}
+		else
+		{
+			/* send the password to the CONTROL ECU indicating that the password is changed */
+			HMI_sendPassword(PASSWORD_IS_CHANGED , password , length);
+		}
+		FSM_dispatch(&g_hmiFsm , EVENT_PASSWORD_SET);
+		break;
+	case ENTER_OPEN_DOOR_PASSWORD:
+	case ENTER_CURRENT_PASSWORD:
+		/* the digits have already been streamed so only the end of the password is sent
+		 * then the reply of the CONTROL ECU is waited for */
+		ENTRY_setCallBack(NULL);
+		UART_sendByte(PIN_END);
+		g_sentTime = HMI_getTime();
+		g_waitingReply = TRUE;
+		LATENCY_record(&g_latency[LATENCY_ENTRY] , g_sentTime - g_keyTime);
+		FSM_dispatch(&g_hmiFsm , EVENT_ENTRY_SENT);
+		break;
+	}
+}
+
+/* [Description]: function responsible for going back to the main options when nobody typed the password
+ * 				  the Control ECU drops the streamed digits when the next command is received
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_cancelEntry(void)
+{
+	ENTRY_setCallBack(NULL);
+	g_sessionCommand = 0;
+	HMI_displayMainOptions();
+}
+
+/* [Description]: the call back function of the entry component for every accepted key , it streams the typed
+ * 				  digit (or the clearing of the digits) to the CONTROL ECU while the password is typed
+ * 				  the command is sent with the first digit so the CONTROL ECU reads the real password
+ * 				  and checks every digit while the next ones are typed
+ * [Arguments]: the typed digit or ENTRY_CLEAR_KEY
+ * [Returns]: no return
+ */
+void HMI_streamDigit(uint8 a_key)
+{
+	if(a_key == ENTRY_CLEAR_KEY)
+	{
+		if(g_sessionCommand == 0)
+		{
+			UART_sendByte(PIN_CLEAR);
+		}
+	}
+	else
+	{
+		if(g_sessionCommand != 0)
+		{
+			/* open the session on the first digit */
+			UART_sendByte(g_sessionCommand);
+			g_sessionCommand = 0;
+		}
+		UART_sendByte(PIN_DIGIT + a_key);
+	}
+}
+
+/* [Description]: function responsible for sending a command followed by all the digits of a password
+ * 				  and the end of the password to the CONTROL ECU
+ * [Arguments]: the command , the address of the password and its length
+ * [Returns]: no return
+ */
+void HMI_sendPassword(uint8 a_command , uint8 *a_passwordPtr , uint8 a_length)
+{
+	uint8 i;
+	UART_sendByte(a_command);
+	for(i=0;i<a_length;i++)
+	{
+		UART_sendByte(PIN_DIGIT + a_passwordPtr[i]);
+	}
+	UART_sendByte(PIN_END);
+}
+
+/* [Description]: function responsible for starting the entry of the password from the KeyPad module
+ * 				  and the password is taken again if the both password are equal it is sent to the CONTROL ECU
+ * 				  to set the password this function should be called only one time at the beginning of the sysytem
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_setPassword(void)
+{
+	g_entryPurpose = ENTER_NEW_PASSWORD;
+	ENTRY_start("Enter New Pass:"); /* display a message to enter the password */
+}
+
+/* [Description]: function responsible for starting the entry of the password from the KeyPad module
+ * 				  when it is complete it is sent to the CONTROL ECU to change password
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_changePassword(void)
+{
+	g_entryPurpose = ENTER_CURRENT_PASSWORD;
+	ENTRY_start("Enter Password:"); /* display message to enter the password */
+	/* stream the digits to the Control ECU with the command to change the password before the first one */
+	g_sessionCommand = CHANGE_PASSWORD;
+	ENTRY_setCallBack(HMI_streamDigit);
+}
+
+/* [Description]: function responsible for starting the entry of the password from the KeyPad module
+ * 				  when it is complete it is sent to the CONTROL ECU to open the door
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_openDoor (void)
+{
+	g_entryPurpose = ENTER_OPEN_DOOR_PASSWORD;
+	ENTRY_start("Enter Password:"); /* display message to enter the password */
+	/* stream the digits to the Control ECU with the command to open the door before the first one */
+	g_sessionCommand = OPEN_DOOR;
+	ENTRY_setCallBack(HMI_streamDigit);
+}
+
+/* [Description]: function responsible for displaying the state of the door received from the CONTROL ECU
+ * 				  while it is unlocking , open or locking
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_displayDoorState(void)
+{
+	LCD_clearScreen();
+	if(g_doorState == DOOR_UNLOCKING)
+	{
+		LCD_displayString("Door is ");
+		LCD_goToRowColumn(1,0);
+		LCD_displayString("Unlocking");
+	}
+	else if(g_doorState == DOOR_OPEN)
+	{
+		LCD_displayString("Door is open");
+	}
+	else if(g_doorState == DOOR_LOCKING)
+	{
+		LCD_displayString("Door is locking");
+	}
+}
+
+/* [Description]: function responsible for going back to the main options when the door is locked again
+ * 				  or displaying that the door was stopped first
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_doorDone(void)
+{
+	if(g_doorState == DOOR_FAULT)
+	{
+		/* the door was stopped or could not be closed */
+		HMI_showMessage("Door stopped" , TICKS_PER_SECOND , HMI_displayMainOptions);
+	}
+	else
+	{
+		HMI_displayMainOptions();
+	}
+}
+
+/* [Description]: function responsible for sending the requests of the keys pressed while the door is moving
+ * [Arguments]: the key event of the KeyPad
+ * [Returns]: no return
+ */
+void HMI_doorKeyProcessing(uint8 a_key)
+{
+	if(a_key == DOOR_STOP_KEY)
+	{
+		UART_sendByte(EMERGENCY_STOP);
+	}
+	else if(a_key == DOOR_HOLD_KEY)
+	{
+		UART_sendByte(EXTEND_HOLD);
+	}
+}
+
+/* [Description]: function responsible for displaying that the entered password is wrong
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_wrongPassword(void)
+{
+	HMI_showMessage("Wrong Password" , TICKS_PER_SECOND , HMI_wrongPasswordDone);
+}
+
+/* [Description]: function responsible for displaying that the CONTROL ECU did not reply then the main options
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_replyTimeout(void)
+{
+	HMI_showMessage("No Reply" , TICKS_PER_SECOND , HMI_displayMainOptions);
+}
+
+/* [Description]: function responsible for displaying the main options after the wrong password message
+ * 				  unless the system is locked
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_wrongPasswordDone(void)
+{
+	/* variable to hold the next queued event */
+	uint8 event;
+	/* the CONTROL ECU counts the wrong passwords and sends SYSTEM_LOCKED after the last one */
+	if((QUEUE_peek(&g_eventQueue , &event) == FALSE) || (event != EVENT_SYSTEM_LOCKED))
+	{
+		HMI_displayMainOptions();
+	}
+}
+
+/* [Description]: function responsible for displaying that the password is set then the main options
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_passwordSet(void)
+{
+	HMI_showMessage("Password is set" , (700/TICK_MS) , HMI_displayMainOptions);
+}
+
+/* [Description]: function responsible for starting the entry of the new password from the KeyPad module
+ * 				  and the password is taken again if the both password are equal it is sent to the CONTROL ECU
+ * 				  to set the new password
+ * [Arguments]: no arguments
+ * [Returns]: no return
+ */
+void HMI_precedeChange(void)
+{
+	g_entryPurpose = ENTER_CHANGED_PASSWORD;
+	ENTRY_start("Enter New Pass:"); /* display a message to enter the new password */
+}
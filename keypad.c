@@ -1,125 +1,273 @@
-/*----------------------------------------------------------------------------------------------------------------------------
- *
- * [Module]: keypad
- *
- * [File Name]: shady_keypad.c
- *
- * [Description]: source file for the keypad driver
- *
- * [Author]:  Shady Ali
- *
-------------------------------------------------------------------------------------------------------------------------------*/
-#include "keypad.h"
-
-#if(N_col==3)
-/* the function which is responsible for mapping the pressed switch key in
- * the keypad to its corresponding number in the 4x3 keypad
- */
-static uint8 KeyPad_4x3_adjustKeyNumber(uint8 a_buttonNumber);
-#elif(N_col==4)
-/* the function which is responsible for mapping the pressed switch key in
- * the keypad to its corresponding number in the 4x4 keypad
- */
-static uint8 KeyPad_4x4_adjustKeyNumber(uint8 a_buttonNumber);
-#endif
-
-/*------------------------------------------------------------------------------------------------------------------------------
- * [Function Name]: KeyPad_getPressedKey
- *
- * [Description]: take the button number for the pressed switch
- *
- * [Args]: none
- *
- * [Returns]: uint8 number representing the pressed number of the keypad
- *
- -----------------------------------------------------------------------------------------------------------------------------*/
-uint8 KeyPad_getPressedKey(void){
-	/* the parameters which is the number of rows and columns*/
-	uint8 col,row;
-	while(1){
-		for(col=0;col<N_col;col++){
-			/*only on of the columns will be output and the rest will be input*/
-			KEYPAD_PORT_DIR=(0b00010000<<col);
-			/* set the output pin to low and enable the internal pull up resistor for row pins*/
-			KEYPAD_PORT_OUT=(~(0b00010000<<col));
-			/*looping on the rows to detect the pressed switch*/
-			for(row=0;row<N_row;row++){
-				if(BIT_IS_CLEAR(KEYPAD_PORT_IN,row)){ /*if the switch in this row*/
-					#if(N_col==3)
-						return KeyPad_4x3_adjustKeyNumber((row*N_col)+col+1);
-					#elif(N_col==4)
-						return KeyPad_4x4_adjustKeyNumber((row*N_col)+col+1);
-					#endif
-				}
-			}
-		}
-	}
-}
-/*------------------------------------------------------------------------------------------------------------------------------
- * [Function Name]: KeyPad_4x3_adjustKeyNumber
- *
- * [Description]: getting the pressed number on the keypad from the switch number
- *
- * [Args]: uint8 a_buttonNumber:
- * 				this argument presents the number of the pressed switch
- *
- *
- -----------------------------------------------------------------------------------------------------------------------------*/
-#if(N_col==3)
-
-static uint8 KeyPad_4x3_adjustKeyNumber(uint8 a_buttonNumber){
-	switch(a_buttonNumber)
-	{
-	case 10: return'*'; /* ASCII for * */
-			 break;
-	case 11: return 0;
-			 break;
-	case 12: return '#'; /*ASCII for # */
-			 break;
-	default: return a_buttonNumber;
-	}
-}
-#elif(N_col==4)
-
-static uint8 KeyPad_4x4_adjustKeyNumber(uint8 a_buttonNumber){
-	switch(a_buttonNumber)
-		{
-			case 1: return 7;
-					break;
-			case 2: return 8;
-					break;
-			case 3: return 9;
-					break;
-			case 4: return '%'; // ASCII Code of %
-					break;
-			case 5: return 4;
-					break;
-			case 6: return 5;
-					break;
-			case 7: return 6;
-					break;
-			case 8: return '*'; /* ASCII Code of '*' */
-					break;
-			case 9: return 1;
-					break;
-			case 10: return 2;
-					break;
-			case 11: return 3;
-					break;
-			case 12: return '-'; /* ASCII Code of '-' */
-					break;
-			case 13: return 13;  /* ASCII of Enter */
-					break;
-			case 14: return 0;
-					break;
-			case 15: return '='; /* ASCII Code of '=' */
-					break;
-			case 16: return '+'; /* ASCII Code of '+' */
-					break;
-			default: return a_buttonNumber;
-		}
-	}
-
-#endif
-
-
+/*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: keypad
+ *
+ * [File Name]: shady_keypad.c
+ *
+ * [Description]: source file for the keypad driver
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+#include "keypad.h"
+#include <avr/sleep.h>
+
+/* flag set by the wake up interrupt when a key is touched while the MCU is sleeping */
+static volatile uint8 g_keyTouched = 0;
+/* number of times the MCU woke up while waiting for a key (touched keys and other interrupts) */
+static volatile uint32 g_wakeUpCount = 0;
+/* the last key scanned by KeyPad_getKeyEvent and for how many scans it has been the same */
+static uint8 g_lastKey = KEYPAD_NO_KEY;
+static uint8 g_stableScans = 0;
+
+#if(N_col==3)
+/* the function which is responsible for mapping the pressed switch key in
+ * the keypad to its corresponding number in the 4x3 keypad
+ */
+static uint8 KeyPad_4x3_adjustKeyNumber(uint8 a_buttonNumber);
+#elif(N_col==4)
+/* the function which is responsible for mapping the pressed switch key in
+ * the keypad to its corresponding number in the 4x4 keypad
+ */
+static uint8 KeyPad_4x4_adjustKeyNumber(uint8 a_buttonNumber);
+#endif
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: KeyPad_scan
+ *
+ * [Description]: scan all the columns of the keypad only once
+ *
+ * [Args]: none
+ *
+ * [Returns]: uint8 number representing the pressed number of the keypad or KEYPAD_NO_KEY
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+uint8 KeyPad_scan(void){
+	/* the parameters which is the number of rows and columns*/
+	uint8 col,row;
+	for(col=0;col<N_col;col++){
+		/*only on of the columns will be output and the rest will be input*/
+		KEYPAD_PORT_DIR=(0b00010000<<col);
+		/* set the output pin to low and enable the internal pull up resistor for row pins*/
+		KEYPAD_PORT_OUT=(~(0b00010000<<col));
+		/* wait for the row lines to settle before reading them as every column is read only once */
+		_delay_us(5);
+		/*looping on the rows to detect the pressed switch*/
+		for(row=0;row<N_row;row++){
+			if(BIT_IS_CLEAR(KEYPAD_PORT_IN,row)){ /*if the switch in this row*/
+				#if(N_col==3)
+					return KeyPad_4x3_adjustKeyNumber((row*N_col)+col+1);
+				#elif(N_col==4)
+					return KeyPad_4x4_adjustKeyNumber((row*N_col)+col+1);
+				#endif
+			}
+		}
+	}
+	return KEYPAD_NO_KEY;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: KeyPad_getKeyEvent
+ *
+ * [Description]: scan the keypad once and report the pressed key only when it has been stable for
+ * 				  KEYPAD_DEBOUNCE_SCANS calls , the key is reported only once per press so holding a key
+ * 				  or the bouncing of the switch does not repeat it , it should be called every tick
+ *
+ * [Args]: none
+ *
+ * [Returns]: uint8 the newly pressed key or KEYPAD_NO_KEY
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+uint8 KeyPad_getKeyEvent(void){
+	uint8 key = KeyPad_scan();
+	if(key != g_lastKey){
+		/* the key changed (pressed , released or bouncing) so start counting again */
+		g_lastKey = key;
+		g_stableScans = 0;
+	}
+	else if(g_stableScans < KEYPAD_DEBOUNCE_SCANS){
+		g_stableScans++;
+		if((g_stableScans == KEYPAD_DEBOUNCE_SCANS) && (key != KEYPAD_NO_KEY)){
+			return key;
+		}
+	}
+	return KEYPAD_NO_KEY;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: KeyPad_isReleased
+ *
+ * [Description]: check if the last KEYPAD_DEBOUNCE_SCANS scans of KeyPad_getKeyEvent found no key , after a key
+ * 				  woke the MCU up it is FALSE until the key is reported and released so the caller does not sleep
+ * 				  before KeyPad_getKeyEvent has seen the key
+ *
+ * [Args]: none
+ *
+ * [Returns]: TRUE if no key is pressed and FALSE otherwise
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+bool KeyPad_isReleased(void){
+	return ((g_lastKey == KEYPAD_NO_KEY) && (g_stableScans == KEYPAD_DEBOUNCE_SCANS));
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [ISR Name]: INT0_vect
+ *
+ * [Description]: one of the rows was pulled low while all the columns are low which means a key is touched
+ * 				  so disable the wake up interrupt and let the sleeping loop switch to the fast scan
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+ISR(INT0_vect)
+{
+	CLEAR_BIT(GICR,INT0);  /* the wake up interrupt is only needed once per key */
+	g_keyTouched = 1;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: KeyPad_enableWakeUp
+ *
+ * [Description]: drive all the columns low with pull up resistors on the rows so that any touched key
+ * 				  pulls its row low , then enable INT0 on the falling edge of the diode-ORed rows
+ *
+ * [Args]: none
+ *
+ * [Returns]: void
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void KeyPad_enableWakeUp(void){
+	/* all the columns are output low and the rows are input with the internal pull up resistors */
+	KEYPAD_PORT_DIR = 0xF0;
+	KEYPAD_PORT_OUT = 0x0F;
+	/* the wake up pin is input with the internal pull up resistor */
+	CLEAR_BIT(KEYPAD_WAKEUP_PORT_DIR,KEYPAD_WAKEUP_PIN);
+	SET_BIT(KEYPAD_WAKEUP_PORT_OUT,KEYPAD_WAKEUP_PIN);
+	/* INT0 on the falling edge : ISC01=1 , ISC00=0 */
+	MCUCR = (MCUCR & 0xFC) | (1<<ISC01);
+	g_keyTouched = 0;
+	SET_BIT(GIFR,INTF0);  /* clear any old flag by writing one to it */
+	SET_BIT(GICR,INT0);
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: KeyPad_sleep
+ *
+ * [Description]: put the MCU in idle sleep mode until any interrupt , it must be called with the global interrupts
+ * 				  disabled after KeyPad_enableWakeUp so the caller can check its own events before sleeping
+ * 				  without losing an interrupt that comes between the check and the sleep , the interrupts are
+ * 				  enabled when it returns , a touched key is then read by KeyPad_getKeyEvent and
+ * 				  KeyPad_isReleased is FALSE until it is reported and released
+ *
+ * [Args]: none
+ *
+ * [Returns]: TRUE if a key is touched and FALSE if another interrupt woke the MCU up
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+bool KeyPad_sleep(void){
+	if(g_keyTouched == 0){
+		set_sleep_mode(SLEEP_MODE_IDLE);
+		sleep_enable();
+		/* the instruction after sei is always executed before any pending interrupt so the
+		 * interrupt can not be lost between checking the flag and sleeping */
+		sei();
+		sleep_cpu();
+		sleep_disable();
+		g_wakeUpCount++;
+	}
+	sei();
+	if(g_keyTouched != 0){
+		/* the touched key is not scanned yet so it is not released until KeyPad_getKeyEvent scans again */
+		g_stableScans = 0;
+	}
+	return (g_keyTouched != 0);
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: KeyPad_getWakeUpCount
+ *
+ * [Description]: get how many times the MCU woke up while sleeping in KeyPad_sleep , every wake up
+ * 				  costs only the cycles of the interrupt and the flag check so the idle cost per hour is
+ * 				  (wake ups per hour) * (cycles per wake up) instead of F_CPU * 3600 cycles of scanning ,
+ * 				  the time spent awake is counted by the caller
+ *
+ * [Args]: none
+ *
+ * [Returns]: uint32 number of wake ups
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+uint32 KeyPad_getWakeUpCount(void){
+	uint32 count;
+	uint8 sreg = SREG;  /* the 32-bit counter is read with the interrupts disabled */
+	cli();
+	count = g_wakeUpCount;
+	SREG = sreg;
+	return count;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: KeyPad_4x3_adjustKeyNumber
+ *
+ * [Description]: getting the pressed number on the keypad from the switch number
+ *
+ * [Args]: uint8 a_buttonNumber:
+ * 				this argument presents the number of the pressed switch
+ *
+ *
+ -----------------------------------------------------------------------------------------------------------------------------*/
+#if(N_col==3)
+
+static uint8 KeyPad_4x3_adjustKeyNumber(uint8 a_buttonNumber){
+	switch(a_buttonNumber)
+	{
+	case 10: return'*'; /* ASCII for * */
+			 break;
+	case 11: return 0;
+			 break;
+	case 12: return '#'; /*ASCII for # */
+			 break;
+	default: return a_buttonNumber;
+	}
+}
+#elif(N_col==4)
+
+static uint8 KeyPad_4x4_adjustKeyNumber(uint8 a_buttonNumber){
+	switch(a_buttonNumber)
+		{
+			case 1: return 7;
+					break;
+			case 2: return 8;
+					break;
+			case 3: return 9;
+					break;
+			case 4: return '%'; // ASCII Code of %
+					break;
+			case 5: return 4;
+					break;
+			case 6: return 5;
+					break;
+			case 7: return 6;
+					break;
+			case 8: return '*'; /* ASCII Code of '*' */
+					break;
+			case 9: return 1;
+					break;
+			case 10: return 2;
+					break;
+			case 11: return 3;
+					break;
+			case 12: return '-'; /* ASCII Code of '-' */
+					break;
+			case 13: return 13;  /* ASCII of Enter */
+					break;
+			case 14: return 0;
+					break;
+			case 15: return '='; /* ASCII Code of '=' */
+					break;
+			case 16: return '+'; /* ASCII Code of '+' */
+					break;
+			default: return a_buttonNumber;
+		}
+	}
+
+#endif
+
+
@@ -1,35 +1,71 @@
-/*----------------------------------------------------------------------------------------------------------------------------
- *
- * [Module]: keypad
- *
- * [File Name]: shady_keypad.h
- *
- * [Description]: header file for the keypad driver
- *
- * [Author]:  Shady Ali
- *
-------------------------------------------------------------------------------------------------------------------------------*/
-
-
-#ifndef KEYPAD_H_
-#define KEYPAD_H_
-
-#include"common_macros.h"
-#include"micro_config.h"
-#include"std_types.h"
-
-/* keypad number of rows and columns*/
-#define N_col 4
-#define N_row 4
-
-/*keypad port configurations*/
-#define KEYPAD_PORT_OUT PORTA
-#define KEYPAD_PORT_IN PINA
-#define KEYPAD_PORT_DIR DDRA
-
-/* prototype for the function responsible for getting the pressed key*/
-
-uint8 KeyPad_getPressedKey(void);
-
-
-#endif /* KEYPAD_H_ */
+/*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: keypad
+ *
+ * [File Name]: shady_keypad.h
+ *
+ * [Description]: header file for the keypad driver
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+
+
+#ifndef KEYPAD_H_
+#define KEYPAD_H_
+
+#include"common_macros.h"
+#include"micro_config.h"
+#include"std_types.h"
+
+/* keypad number of rows and columns*/
+#define N_col 4
+#define N_row 4
+
+/*keypad port configurations*/
+#define KEYPAD_PORT_OUT PORTA
+#define KEYPAD_PORT_IN PINA
+#define KEYPAD_PORT_DIR DDRA
+
+/* wake up configurations: the row pins are diode-ORed into INT0 so that touching any key
+ * while all the columns are driven low pulls the interrupt pin low and wakes the MCU up */
+#define KEYPAD_WAKEUP_PORT_OUT PORTD
+#define KEYPAD_WAKEUP_PORT_DIR DDRD
+#define KEYPAD_WAKEUP_PIN PD2
+
+/* value returned by the non blocking functions when there is no pressed key */
+#define KEYPAD_NO_KEY 0xFF
+
+/* number of consecutive scans a key has to be stable for before it is reported as a key event */
+#define KEYPAD_DEBOUNCE_SCANS 3
+
+/* prototype for the function responsible for scanning the keypad only once without waiting*/
+
+uint8 KeyPad_scan(void);
+
+/* prototype for the function responsible for reporting a debounced key event once per press
+ * it should be called periodically (every tick) */
+
+uint8 KeyPad_getKeyEvent(void);
+
+/* prototype for the function responsible for checking that KeyPad_getKeyEvent found no key for
+ * KEYPAD_DEBOUNCE_SCANS scans*/
+
+bool KeyPad_isReleased(void);
+
+/* prototype for the function responsible for driving all the columns low and enabling the
+ * wake up interrupt so that the next touched key wakes the MCU up*/
+
+void KeyPad_enableWakeUp(void);
+
+/* prototype for the function responsible for putting the MCU in idle sleep mode until any interrupt
+ * it is called with the interrupts disabled and returns TRUE if a key is touched*/
+
+bool KeyPad_sleep(void);
+
+/* prototype for the function returning how many times the MCU woke up while waiting for a key*/
+
+uint32 KeyPad_getWakeUpCount(void);
+
+
+#endif /* KEYPAD_H_ */
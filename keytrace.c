@@ -0,0 +1,129 @@
+  /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Key Trace
+ *
+ * [File Name]:keytrace.c
+ *
+ * [Description]: source file for the Key Trace
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+#include"keytrace.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* the last recorded keys , g_next is the place of the next record and the oldest one when the trace is full */
+static Keytrace_RecordType g_records[KEYTRACE_SIZE];
+static uint8 g_next = 0;
+static uint8 g_count = 0;
+/* the time of the last recorded key */
+static uint32 g_lastKeyTime = 0;
+
+/* the trace being replayed , the index of its next key and the time of the previous replayed key */
+static const Keytrace_RecordType *g_replay_Ptr = NULL;
+static uint8 g_replayLength = 0;
+static uint8 g_replayIndex = 0;
+static uint32 g_replayTime = 0;
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: KEYTRACE_record
+ * [Description]:   function responsible for recording one key event with the ticks passed since the previous
+ * 					key , the oldest record is overwritten when the trace is full
+ * [Args]: uint8 a_key , uint32 a_now : the time of the key in ticks
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void KEYTRACE_record(uint8 a_key , uint32 a_now)
+{
+	uint32 gap = a_now - g_lastKeyTime;
+	g_lastKeyTime = a_now;
+	g_records[g_next].key = a_key;
+	g_records[g_next].gapTicks = (gap > 0xFFFF) ? 0xFFFF : (uint16)gap;
+	g_next = (g_next + 1) & (KEYTRACE_SIZE - 1);
+	if(g_count < KEYTRACE_SIZE)
+	{
+		g_count++;
+	}
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: KEYTRACE_getRecords
+ * [Description]:   function responsible for copying the recorded keys from the oldest to the newest , the copy
+ * 					can be given to KEYTRACE_startReplay as it is
+ * [Args]: Keytrace_RecordType *a_records_Ptr : an array of KEYTRACE_SIZE records
+ * [Returns]: uint8 : the number of the copied records
+ -----------------------------------------------------------------------------------------------------------------------------*/
+uint8 KEYTRACE_getRecords(Keytrace_RecordType *a_records_Ptr)
+{
+	uint8 i;
+	uint8 index = (g_next - g_count) & (KEYTRACE_SIZE - 1);
+	for(i=0;i<g_count;i++)
+	{
+		a_records_Ptr[i] = g_records[index];
+		index = (index + 1) & (KEYTRACE_SIZE - 1);
+	}
+	return g_count;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: KEYTRACE_clear
+ * [Description]:   function responsible for dropping the recorded keys
+ * [Args]: none
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void KEYTRACE_clear(void)
+{
+	g_next = 0;
+	g_count = 0;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: KEYTRACE_startReplay
+ * [Description]:   function responsible for starting the replay of a trace , the first key is given after its
+ * 					gap from now and every next key after its gap from the previous one
+ * [Args]: const Keytrace_RecordType *a_trace_Ptr , uint8 a_length , uint32 a_now : the time in ticks
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void KEYTRACE_startReplay(const Keytrace_RecordType *a_trace_Ptr , uint8 a_length , uint32 a_now)
+{
+	g_replay_Ptr = a_trace_Ptr;
+	g_replayLength = a_length;
+	g_replayIndex = 0;
+	g_replayTime = a_now;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: KEYTRACE_replayKey
+ * [Description]:   function responsible for giving the next key of the replayed trace when its gap is passed ,
+ * 					it should be called every tick instead of KeyPad_getKeyEvent while replaying
+ * [Args]: uint32 a_now : the time in ticks
+ * [Returns]: uint8 : the due key or KEYTRACE_NO_KEY
+ -----------------------------------------------------------------------------------------------------------------------------*/
+uint8 KEYTRACE_replayKey(uint32 a_now)
+{
+	const Keytrace_RecordType *record_Ptr;
+	if(g_replayIndex >= g_replayLength)
+	{
+		return KEYTRACE_NO_KEY;
+	}
+	record_Ptr = &g_replay_Ptr[g_replayIndex];
+	if((a_now - g_replayTime) < record_Ptr->gapTicks)
+	{
+		return KEYTRACE_NO_KEY;
+	}
+	g_replayTime = a_now;
+	g_replayIndex++;
+	return record_Ptr->key;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: KEYTRACE_isReplaying
+ * [Description]:   function responsible for checking if a replayed trace still has keys
+ * [Args]: none
+ * [Returns]: bool : TRUE while replaying
+ -----------------------------------------------------------------------------------------------------------------------------*/
+bool KEYTRACE_isReplaying(void)
+{
+	return (g_replayIndex < g_replayLength);
+}
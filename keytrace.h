@@ -0,0 +1,46 @@
+ /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Key Trace
+ *
+ * [File Name]: keytrace.h
+ *
+ * [Description]: header file for the Key Trace , it records the debounced key events of the KeyPad with the
+ * 				  ticks passed since the previous key so a session seen in the field can be read out and
+ * 				  replayed later with the same timing into the same entry logic instead of the KeyPad
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef KEYTRACE_H_
+#define KEYTRACE_H_
+
+#include"common_macros.h"
+#include"micro_config.h"
+#include"std_types.h"
+
+/* the number of the last keys kept by the recorder , it should be a power of 2 */
+#define KEYTRACE_SIZE 32
+
+/* value returned by KEYTRACE_replayKey when no key is due */
+#define KEYTRACE_NO_KEY 0xFF
+
+/*
+ * Description: structure of one record of the trace (3 bytes)
+ * 1. the key reported by the KeyPad
+ * 2. the ticks passed since the previous key (saturated at 0xFFFF)
+ */
+typedef struct
+{
+	uint8 key;
+	uint16 gapTicks;
+}Keytrace_RecordType;
+
+void KEYTRACE_record(uint8 a_key , uint32 a_now);                      /* function prototype for recording a key */
+uint8 KEYTRACE_getRecords(Keytrace_RecordType *a_records_Ptr);          /* function prototype for reading the recorded keys */
+void KEYTRACE_clear(void);                                              /* function prototype for clearing the recorded keys */
+void KEYTRACE_startReplay(const Keytrace_RecordType *a_trace_Ptr , uint8 a_length , uint32 a_now); /* starting a replay */
+uint8 KEYTRACE_replayKey(uint32 a_now);                                 /* function prototype for taking the next due key */
+bool KEYTRACE_isReplaying(void);                                        /* function prototype for checking a running replay */
+
+#endif /* KEYTRACE_H_ */
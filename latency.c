@@ -0,0 +1,121 @@
+  /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Latency
+ *
+ * [File Name]:latency.c
+ *
+ * [Description]: source file for the Latency statistics
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+#include"latency.h"
+#include<avr/pgmspace.h>
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* the number of bits of the numbers from 0 to 15 */
+static const uint8 g_nibbleBits[16] PROGMEM={0,1,2,2,3,3,3,3,4,4,4,4,4,4,4,4};
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: LATENCY_record
+ * [Description]:   function responsible for adding a measure to the statistics of a stage , the measures stop
+ * 					being added when the count or the sum would overflow so the mean stays right
+ * [Args]: Latency_StatType *a_stat_Ptr , uint32 a_time : the time of the stage in micro seconds
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void LATENCY_record(Latency_StatType *a_stat_Ptr , uint32 a_time)
+{
+	if((a_stat_Ptr->s_count == 0xFFFF) || ((a_stat_Ptr->s_sum + a_time) < a_stat_Ptr->s_sum))
+	{
+		return;
+	}
+	if((a_stat_Ptr->s_count == 0) || (a_time < a_stat_Ptr->s_min))
+	{
+		a_stat_Ptr->s_min = a_time;
+	}
+	if(a_time > a_stat_Ptr->s_max)
+	{
+		a_stat_Ptr->s_max = a_time;
+	}
+	a_stat_Ptr->s_sum += a_time;
+	a_stat_Ptr->s_count++;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: LATENCY_getMean
+ * [Description]:   function responsible for reading the mean time of a stage
+ * [Args]: const Latency_StatType *a_stat_Ptr
+ * [Returns]: uint32 : the mean in micro seconds or 0 if the stage was not measured
+ -----------------------------------------------------------------------------------------------------------------------------*/
+uint32 LATENCY_getMean(const Latency_StatType *a_stat_Ptr)
+{
+	if(a_stat_Ptr->s_count == 0)
+	{
+		return 0;
+	}
+	return a_stat_Ptr->s_sum / a_stat_Ptr->s_count;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: LATENCY_clear
+ * [Description]:   function responsible for clearing the statistics of a stage to start a new measurement
+ * [Args]: Latency_StatType *a_stat_Ptr
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void LATENCY_clear(Latency_StatType *a_stat_Ptr)
+{
+	a_stat_Ptr->s_min = 0;
+	a_stat_Ptr->s_max = 0;
+	a_stat_Ptr->s_sum = 0;
+	a_stat_Ptr->s_count = 0;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: LATENCY_getBucket
+ * [Description]:   function responsible for finding the bucket of a time , it is the number of bits of the time
+ * 					found in three steps and one table read without a loop or a division
+ * [Args]: uint32 a_time : the time in micro seconds
+ * [Returns]: uint8 : the bucket from 0 to LATENCY_BUCKETS - 1
+ -----------------------------------------------------------------------------------------------------------------------------*/
+uint8 LATENCY_getBucket(uint32 a_time)
+{
+	uint8 bits = 0;
+	if(a_time > 0xFFFF)
+	{
+		a_time >>= 16;
+		bits = 16;
+	}
+	if(a_time > 0xFF)
+	{
+		a_time >>= 8;
+		bits += 8;
+	}
+	if(a_time > 0x0F)
+	{
+		a_time >>= 4;
+		bits += 4;
+	}
+	bits += pgm_read_byte(&g_nibbleBits[a_time]);
+	if(bits >= LATENCY_BUCKETS)
+	{
+		bits = LATENCY_BUCKETS - 1;
+	}
+	return bits;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: LATENCY_addToHistogram
+ * [Description]:   function responsible for counting a time in its bucket , the count of a bucket stops at 0xFFFF
+ * [Args]: Latency_HistogramType *a_histogram_Ptr , uint32 a_time : the time in micro seconds
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void LATENCY_addToHistogram(Latency_HistogramType *a_histogram_Ptr , uint32 a_time)
+{
+	uint16 *bucket_Ptr = &a_histogram_Ptr->s_buckets[LATENCY_getBucket(a_time)];
+	if(*bucket_Ptr != 0xFFFF)
+	{
+		(*bucket_Ptr)++;
+	}
+}
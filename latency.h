@@ -0,0 +1,52 @@
+ /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Latency
+ *
+ * [File Name]: latency.h
+ *
+ * [Description]: header file for the Latency statistics , every stage of a path (for example from the last key
+ * 				  to the start of the motor) is measured in micro seconds and the minimum , the maximum , the sum
+ * 				  and the number of the measures of the stage are kept so every change has a before and after ,
+ * 				  a histogram keeps the distribution of a time in buckets of powers of 2 in a fixed memory
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef LATENCY_H_
+#define LATENCY_H_
+
+#include"common_macros.h"
+#include"micro_config.h"
+#include"std_types.h"
+
+/* the number of the buckets of a histogram , bucket 0 counts 0 us , bucket n counts the times from 2^(n-1) to
+ * 2^n - 1 us and the last bucket counts every longer time too (16 buckets : 16.4 ms and more) */
+#define LATENCY_BUCKETS 16
+
+/*
+ * Description: structure of the statistics of one stage , the times are in micro seconds
+ */
+typedef struct
+{
+	uint32 s_min;
+	uint32 s_max;
+	uint32 s_sum;
+	uint16 s_count;
+}Latency_StatType;
+
+/*
+ * Description: structure of a histogram , the number of the times in every bucket (saturated at 0xFFFF)
+ */
+typedef struct
+{
+	uint16 s_buckets[LATENCY_BUCKETS];
+}Latency_HistogramType;
+
+void LATENCY_record(Latency_StatType *a_stat_Ptr , uint32 a_time);  /* function prototype for adding a measure of a stage */
+uint32 LATENCY_getMean(const Latency_StatType *a_stat_Ptr);         /* function prototype for reading the mean of a stage */
+void LATENCY_clear(Latency_StatType *a_stat_Ptr);                   /* function prototype for clearing the statistics of a stage */
+void LATENCY_addToHistogram(Latency_HistogramType *a_histogram_Ptr , uint32 a_time); /* adding a time to a histogram */
+uint8 LATENCY_getBucket(uint32 a_time);                             /* function prototype for finding the bucket of a time */
+
+#endif /* LATENCY_H_ */
@@ -1,114 +1,167 @@
- /******************************************************************************
- *
- * Module: LCD
- *
- * File Name: lcd.c
- *
- * Description: Source file for the LCD driver
- *
- * Author: Mohamed Tarek
- *
- *******************************************************************************/
-
-#include "lcd.h"
-
-/*******************************************************************************
- *                      Functions Definitions                                  *
- *******************************************************************************/
-void LCD_init(void)
-{
-	LCD_DATA_PORT_DIR = 0xFF; /* Configure the data port as output port */ 
-	LCD_CTRL_PORT_DIR |= (1<<E) | (1<<RS) | (1<<RW); /* Configure the control pins(E,RS,RW) as output pins */
-	
-	LCD_sendCommand(TWO_LINE_LCD_Eight_BIT_MODE); /* use 2-line lcd + 8-bit Data Mode + 5*7 dot display Mode */
-	
-	LCD_sendCommand(CURSOR_OFF); /* cursor off */
-	
-	LCD_sendCommand(CLEAR_COMMAND); /* clear LCD at the beginning */
-}
-
-void LCD_sendCommand(uint8 command)
-{
-	CLEAR_BIT(LCD_CTRL_PORT,RS); /* Instruction Mode RS=0 */
-	CLEAR_BIT(LCD_CTRL_PORT,RW); /* write data to LCD so RW=0 */
-	_delay_ms(1); /* delay for processing Tas = 50ns */
-	SET_BIT(LCD_CTRL_PORT,E); /* Enable LCD E=1 */
-	_delay_ms(1); /* delay for processing Tpw - Tdws = 190ns */
-	LCD_DATA_PORT = command; /* out the required command to the data bus D0 --> D7 */
-	_delay_ms(1); /* delay for processing Tdsw = 100ns */
-	CLEAR_BIT(LCD_CTRL_PORT,E); /* disable LCD E=0 */
-	_delay_ms(1); /* delay for processing Th = 13ns */
-}
-
-void LCD_displayCharacter(uint8 data)
-{
-	SET_BIT(LCD_CTRL_PORT,RS); /* Data Mode RS=1 */
-	CLEAR_BIT(LCD_CTRL_PORT,RW); /* write data to LCD so RW=0 */
-	_delay_ms(1); /* delay for processing Tas = 50ns */
-	SET_BIT(LCD_CTRL_PORT,E); /* Enable LCD E=1 */
-	_delay_ms(1); /* delay for processing Tpw - Tdws = 190ns */
-	LCD_DATA_PORT = data; /* out the required data char to the data bus D0 --> D7 */
-	_delay_ms(1); /* delay for processing Tdsw = 100ns */
-	CLEAR_BIT(LCD_CTRL_PORT,E); /* disable LCD E=0 */
-	_delay_ms(1); /* delay for processing Th = 13ns */	
-}
-
-void LCD_displayString(const char *Str)
-{
-	uint8 i = 0;
-	while(Str[i] != '\0')
-	{
-		LCD_displayCharacter(Str[i]);
-		i++;
-	}
-	/***************** Another Method ***********************
-	while((*Str) != '\0')
-	{
-		LCD_displayCharacter(*Str);
-		Str++;
-	}		
-	*********************************************************/
-}
-
-void LCD_goToRowColumn(uint8 row,uint8 col)
-{
-	uint8 Address;
-	
-	/* first of all calculate the required address */
-	switch(row)
-	{
-		case 0:
-				Address=col;
-				break;
-		case 1:
-				Address=col+0x40;
-				break;
-		case 2:
-				Address=col+0x10;
-				break;
-		case 3:
-				Address=col+0x50;
-				break;
-	}					
-	/* to write to a specific address in the LCD 
-	 * we need to apply the corresponding command 0b10000000+Address */
-	LCD_sendCommand(Address | SET_CURSOR_LOCATION); 
-}
-
-void LCD_displayStringRowColumn(uint8 row,uint8 col,const char *Str)
-{
-	LCD_goToRowColumn(row,col); /* go to to the required LCD position */
-	LCD_displayString(Str); /* display the string */
-}
-
-void LCD_intgerToString(int data)
-{
-   char buff[16]; /* String to hold the ascii result */
-   itoa(data,buff,10); /* 10 for decimal */
-   LCD_displayString(buff);
-}
-
-void LCD_clearScreen(void)
-{
-	LCD_sendCommand(CLEAR_COMMAND); //clear display 
-}
+ /******************************************************************************
+ *
+ * Module: LCD
+ *
+ * File Name: lcd.c
+ *
+ * Description: Source file for the LCD driver
+ *
+ * Author: Mohamed Tarek
+ *
+ *******************************************************************************/
+
+#include "lcd.h"
+#include "probe.h"
+
+/*******************************************************************************
+ *                      Global Variables                                       *
+ *******************************************************************************/
+/* the reads of the busy flag that found the LCD still busy since reset */
+static uint32 g_busyPolls = 0;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+/* wait until the LCD finishes the last command by reading its busy flag instead of
+ * waiting the worst case time of every command */
+static void LCD_waitBusy(void)
+{
+	uint16 polls;
+	uint8 busy;
+	LCD_DATA_PORT_DIR = 0x00; /* Configure the data port as input port to read the busy flag */
+	CLEAR_BIT(LCD_CTRL_PORT,RS); /* Instruction Mode RS=0 */
+	SET_BIT(LCD_CTRL_PORT,RW); /* read from LCD so RW=1 */
+	for(polls = 0; polls < LCD_BUSY_MAX_POLLS; polls++)
+	{
+		SET_BIT(LCD_CTRL_PORT,E); /* Enable LCD E=1 */
+		_delay_us(1); /* delay for processing Tddr = 160ns */
+		busy = BIT_IS_SET(LCD_DATA_PORT_IN,LCD_BUSY_FLAG);
+		CLEAR_BIT(LCD_CTRL_PORT,E); /* disable LCD E=0 */
+		_delay_us(1); /* delay for processing Tcycle = 500ns */
+		if(!busy)
+		{
+			break;
+		}
+		g_busyPolls++;
+	}
+	CLEAR_BIT(LCD_CTRL_PORT,RW); /* write data to LCD so RW=0 */
+	LCD_DATA_PORT_DIR = 0xFF; /* Configure the data port as output port again */
+}
+
+/* write one command (RS=0) or one data byte (RS=1) to the LCD */
+static void LCD_write(uint8 value, uint8 rs)
+{
+	if(rs)
+	{
+		SET_BIT(LCD_CTRL_PORT,RS); /* Data Mode RS=1 */
+	}
+	else
+	{
+		CLEAR_BIT(LCD_CTRL_PORT,RS); /* Instruction Mode RS=0 */
+	}
+	CLEAR_BIT(LCD_CTRL_PORT,RW); /* write data to LCD so RW=0 */
+	SET_BIT(LCD_CTRL_PORT,E); /* Enable LCD E=1 , Tas = 40ns is passed already */
+	LCD_DATA_PORT = value; /* out the required value to the data bus D0 --> D7 */
+	_delay_us(1); /* delay for processing Tpw = 230ns and Tdsw = 80ns */
+	CLEAR_BIT(LCD_CTRL_PORT,E); /* disable LCD E=0 , Th = 10ns is passed by the next instruction */
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+void LCD_init(void)
+{
+	LCD_DATA_PORT_DIR = 0xFF; /* Configure the data port as output port */ 
+	LCD_CTRL_PORT_DIR |= (1<<E) | (1<<RS) | (1<<RW); /* Configure the control pins(E,RS,RW) as output pins */
+	
+	_delay_ms(40); /* the LCD needs more than 40ms after the power is on before the first instruction */
+	/* the busy flag can be read but can not be trusted before the function set so it is written directly */
+	LCD_write(TWO_LINE_LCD_Eight_BIT_MODE,0); /* use 2-line lcd + 8-bit Data Mode + 5*7 dot display Mode */
+	
+	LCD_sendCommand(CURSOR_OFF); /* cursor off */
+	
+	LCD_sendCommand(CLEAR_COMMAND); /* clear LCD at the beginning */
+}
+
+void LCD_sendCommand(uint8 command)
+{
+	/* the LCD executes the command after E falls so only wait for the previous one ,
+	 * the CPU goes on while the LCD is executing */
+	PROBE_ENTER(PROBE_LCD_COMMAND);
+	LCD_waitBusy();
+	LCD_write(command,0);
+	PROBE_EXIT(PROBE_LCD_COMMAND);
+}
+
+void LCD_displayCharacter(uint8 data)
+{
+	PROBE_ENTER(PROBE_LCD_DATA);
+	LCD_waitBusy();
+	LCD_write(data,1);
+	PROBE_EXIT(PROBE_LCD_DATA);
+}
+
+void LCD_displayString(const char *Str)
+{
+	uint8 i = 0;
+	while(Str[i] != '\0')
+	{
+		LCD_displayCharacter(Str[i]);
+		i++;
+	}
+	/***************** Another Method ***********************
+	while((*Str) != '\0')
+	{
+		LCD_displayCharacter(*Str);
+		Str++;
+	}		
+	*********************************************************/
+}
+
+void LCD_goToRowColumn(uint8 row,uint8 col)
+{
+	uint8 Address;
+	
+	/* first of all calculate the required address */
+	switch(row)
+	{
+		case 0:
+				Address=col;
+				break;
+		case 1:
+				Address=col+0x40;
+				break;
+		case 2:
+				Address=col+0x10;
+				break;
+		case 3:
+				Address=col+0x50;
+				break;
+	}					
+	/* to write to a specific address in the LCD 
+	 * we need to apply the corresponding command 0b10000000+Address */
+	LCD_sendCommand(Address | SET_CURSOR_LOCATION); 
+}
+
+void LCD_displayStringRowColumn(uint8 row,uint8 col,const char *Str)
+{
+	LCD_goToRowColumn(row,col); /* go to to the required LCD position */
+	LCD_displayString(Str); /* display the string */
+}
+
+void LCD_intgerToString(int data)
+{
+   char buff[16]; /* String to hold the ascii result */
+   itoa(data,buff,10); /* 10 for decimal */
+   LCD_displayString(buff);
+}
+
+void LCD_clearScreen(void)
+{
+	LCD_sendCommand(CLEAR_COMMAND); //clear display 
+}
+
+uint32 LCD_getBusyPolls(void)
+{
+	return g_busyPolls; /* the LCD is only used by the main loop */
+}
@@ -0,0 +1,60 @@
+  /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Log
+ *
+ * [File Name]:log.c
+ *
+ * [Description]: source file for the tokenized Log
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+#include"log.h"
+#include"uart.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* the messages dropped because the transmit queue was full */
+static uint16 g_dropped = 0;
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: LOG_write
+ * [Description]:   function responsible for queueing one message to the UART without waiting , the message is
+ * 					dropped and counted when the transmit queue has no place for all of it , it is called from
+ * 					the main loop only (LOG0 , LOG1 , LOG2)
+ * [Args]: Log_Token a_token , const uint8 *a_args_Ptr , uint8 a_size : the bytes of the arguments
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void LOG_write(Log_Token a_token , const uint8 *a_args_Ptr , uint8 a_size)
+{
+	uint8 frame[3 + LOG_MAX_ARGS];
+	uint8 i;
+	if(a_size > LOG_MAX_ARGS)
+	{
+		a_size = LOG_MAX_ARGS;
+	}
+	frame[0] = LOG_FRAME;
+	frame[1] = (uint8)((uint16)a_token >> 8);
+	frame[2] = (uint8)a_token;
+	for(i=0;i<a_size;i++)
+	{
+		frame[3 + i] = a_args_Ptr[i];
+	}
+	if((UART_queueBytes(frame , 3 + a_size) == FALSE) && (g_dropped != 0xFFFF))
+	{
+		g_dropped++;
+	}
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: LOG_getDropped
+ * [Description]:   function responsible for reading the number of the messages dropped because the transmit
+ * 					queue was full
+ * [Args]: void
+ * [Returns]: uint16
+ -----------------------------------------------------------------------------------------------------------------------------*/
+uint16 LOG_getDropped(void)
+{
+	return g_dropped;
+}
@@ -0,0 +1,75 @@
+ /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Log
+ *
+ * [File Name]: log.h
+ *
+ * [Description]: header file for the tokenized Log , a message is sent as LOG_FRAME , a 16 bit token (high byte
+ * 				  first) and the raw bytes of its arguments through the transmit queue of the UART , the format
+ * 				  strings of LOG_MESSAGES are never compiled into the firmware , tools/logdecode.py reads them
+ * 				  from this file to print the messages so a message costs a few bytes instead of a printf
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef LOG_H_
+#define LOG_H_
+
+#include"common_macros.h"
+#include"micro_config.h"
+#include"std_types.h"
+
+/* set to 1 to send the messages , the UART is also the link between the ECUs so only on the bench */
+#define LOG_ENABLE 0
+
+/* the first byte of every message */
+#define LOG_FRAME 0x18
+
+/* the most bytes of arguments of one message */
+#define LOG_MAX_ARGS 4
+
+/*
+ * the messages : X(token , number of bytes of the arguments , format printed by the host)
+ * one %u takes all the bytes of the arguments (high byte first) , more %u take one byte each ,
+ * add new messages at the end so the tokens of the old messages do not change
+ */
+#define LOG_MESSAGES(X) \
+	X(LOG_STARTED , 0 , "control ecu started") \
+	X(LOG_DOOR_STATE , 1 , "door state %u") \
+	X(LOG_WRONG_PASSWORD , 1 , "wrong password , %u in a row") \
+	X(LOG_LOCKOUT , 2 , "locked for %u sec") \
+	X(LOG_CLOSE_RETRY , 1 , "door stalled while closing , attempt %u") \
+	X(LOG_EEPROM_FAILED , 0 , "writing the password to the EEPROM failed")
+
+#define LOG_TOKEN(a_token , a_size , a_format) a_token ,
+
+/*
+ * Description: enumeration of the tokens of the messages
+ */
+typedef enum
+{
+	LOG_MESSAGES(LOG_TOKEN)
+	LOG_TOKENS
+}Log_Token;
+
+#if LOG_ENABLE
+#define LOG0(a_token) LOG_write((a_token) , NULL , 0)
+#define LOG1(a_token , a_byte) do{ \
+		uint8 log_args[1] = {(a_byte)}; \
+		LOG_write((a_token) , log_args , 1); \
+	}while(0)
+#define LOG2(a_token , a_word) do{ \
+		uint8 log_args[2] = {(uint8)((a_word) >> 8) , (uint8)(a_word)}; \
+		LOG_write((a_token) , log_args , 2); \
+	}while(0)
+#else
+#define LOG0(a_token)
+#define LOG1(a_token , a_byte)
+#define LOG2(a_token , a_word)
+#endif
+
+void LOG_write(Log_Token a_token , const uint8 *a_args_Ptr , uint8 a_size); /* function prototype for sending a message */
+uint16 LOG_getDropped(void);                                               /* function prototype for reading the dropped messages */
+
+#endif /* LOG_H_ */
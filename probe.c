@@ -0,0 +1,63 @@
+  /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Cycle Probe
+ *
+ * [File Name]:probe.c
+ *
+ * [Description]: source file for the Cycle Probe
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+#include"probe.h"
+
+#if PROBE_ENABLE
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+Probe_BufferType g_probe;
+#endif
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: PROBE_getRecords
+ * [Description]:   function responsible for copying the probes from the oldest to the newest , nothing is copied
+ * 					when the probes are compiled out
+ * [Args]: Probe_RecordType *a_records_Ptr : an array of PROBE_SIZE probes
+ * [Returns]: uint8 : the number of the copied probes
+ -----------------------------------------------------------------------------------------------------------------------------*/
+uint8 PROBE_getRecords(Probe_RecordType *a_records_Ptr)
+{
+	uint8 count = 0;
+#if PROBE_ENABLE
+	uint8 index;
+	uint8 sreg = SREG;
+	cli();
+	index = (g_probe.s_next - g_probe.s_count) & (PROBE_SIZE - 1);
+	for(count=0;count<g_probe.s_count;count++)
+	{
+		a_records_Ptr[count] = g_probe.s_records[index];
+		index = (index + 1) & (PROBE_SIZE - 1);
+	}
+	SREG = sreg;
+#else
+	(void)a_records_Ptr; /* nothing is recorded */
+#endif
+	return count;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: PROBE_clear
+ * [Description]:   function responsible for dropping the probes
+ * [Args]: void
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void PROBE_clear(void)
+{
+#if PROBE_ENABLE
+	uint8 sreg = SREG;
+	cli();
+	g_probe.s_next = 0;
+	g_probe.s_count = 0;
+	SREG = sreg;
+#endif
+}
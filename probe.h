@@ -0,0 +1,89 @@
+ /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Cycle Probe
+ *
+ * [File Name]: probe.h
+ *
+ * [Description]: header file for the Cycle Probe , PROBE_ENTER and PROBE_EXIT store the counter of Timer 1 (1 us)
+ * 				  with the probe id in a ring in the RAM at the start and the end of the measured code so the
+ * 				  cost of the interrupts and the hot functions is measured on the real hardware , the probes
+ * 				  are a few instructions each and are compiled out when PROBE_ENABLE is 0
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef PROBE_H_
+#define PROBE_H_
+
+#include"common_macros.h"
+#include"micro_config.h"
+#include"std_types.h"
+
+/* set to 1 to compile the probes in */
+#define PROBE_ENABLE 0
+
+/* the number of the last probes kept , it should be a power of 2 (3 bytes each) */
+#define PROBE_SIZE 32
+
+/* the probe ids , the exit of a probe has PROBE_EXIT_FLAG set in its id */
+#define PROBE_UART_RX_ISR 0     /* the receive interrupt of the UART */
+#define PROBE_TICK_ISR 1        /* the compare interrupt of Timer 1 (the tick) */
+#define PROBE_EEPROM_READ 2     /* EEPROM_readArray */
+#define PROBE_COMPARE 3         /* CONTROL_compare */
+#define PROBE_LCD_COMMAND 4     /* LCD_sendCommand */
+#define PROBE_LCD_DATA 5        /* LCD_displayCharacter */
+#define PROBE_EXIT_FLAG 0x80
+
+/*
+ * Description: structure of one probe (3 bytes)
+ * 1. the probe id , with PROBE_EXIT_FLAG at the exit
+ * 2. the counter of Timer 1 , it counts micro seconds from 0 to TICK_COMPARE_VALUE so the time between an
+ *    enter and its exit is (exit - enter) modulo (TICK_COMPARE_VALUE + 1)
+ */
+typedef struct
+{
+	uint8 id;
+	uint16 time;
+}Probe_RecordType;
+
+/*
+ * Description: structure of the ring of the probes , s_next is the place of the next probe and the oldest
+ * probe when s_count is PROBE_SIZE
+ */
+typedef struct
+{
+	Probe_RecordType s_records[PROBE_SIZE];
+	uint8 s_next;
+	uint8 s_count;
+}Probe_BufferType;
+
+#if PROBE_ENABLE
+/* the ring is global so the probes are written in place without a function call */
+extern Probe_BufferType g_probe;
+
+#define PROBE_RECORD(a_id) do{ \
+		uint8 probe_sreg = SREG; \
+		uint8 probe_index; \
+		cli(); \
+		probe_index = g_probe.s_next; \
+		g_probe.s_records[probe_index].time = TCNT1; \
+		g_probe.s_records[probe_index].id = (a_id); \
+		g_probe.s_next = (probe_index + 1) & (PROBE_SIZE - 1); \
+		if(g_probe.s_count < PROBE_SIZE) \
+		{ \
+			g_probe.s_count++; \
+		} \
+		SREG = probe_sreg; \
+	}while(0)
+#define PROBE_ENTER(a_id) PROBE_RECORD(a_id)
+#define PROBE_EXIT(a_id) PROBE_RECORD((a_id) | PROBE_EXIT_FLAG)
+#else
+#define PROBE_ENTER(a_id)
+#define PROBE_EXIT(a_id)
+#endif
+
+uint8 PROBE_getRecords(Probe_RecordType *a_records_Ptr);   /* function prototype for reading the probes */
+void PROBE_clear(void);                                    /* function prototype for dropping the probes */
+
+#endif /* PROBE_H_ */
@@ -0,0 +1,116 @@
+  /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Event Queue
+ *
+ * [File Name]:queue.c
+ *
+ * [Description]: source file for the Event Queue
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+#include"queue.h"
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: QUEUE_put
+ * [Description]:   function responsible for putting an event at the head of the queue , it is called by the
+ * 					producer only (the interrupts) , the event is written before the head is moved so the
+ * 					consumer never reads an event that is not written yet , if the queue is full the event
+ * 					is dropped and counted
+ * [Args]: Queue_Type *a_queue_Ptr , uint8 a_event
+ * [Returns]: bool : FALSE if the queue is full
+ -----------------------------------------------------------------------------------------------------------------------------*/
+bool QUEUE_put(Queue_Type *a_queue_Ptr , uint8 a_event)
+{
+	uint8 head = a_queue_Ptr->s_head;
+	uint8 next = (head + 1) & (a_queue_Ptr->s_size - 1);
+	if(next == a_queue_Ptr->s_tail)
+	{
+		if(a_queue_Ptr->s_overflows < 0xFFFF)
+		{
+			a_queue_Ptr->s_overflows++;
+		}
+		return FALSE;
+	}
+	a_queue_Ptr->s_buffer_Ptr[head] = a_event;
+	a_queue_Ptr->s_head = next;
+	return TRUE;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: QUEUE_get
+ * [Description]:   function responsible for taking the oldest event of the queue , it is called by the
+ * 					consumer only (the main loop) , the indices are one byte so they are read and written
+ * 					at once and the interrupts are never disabled
+ * [Args]: Queue_Type *a_queue_Ptr , uint8 *a_event_Ptr
+ * [Returns]: bool : FALSE if the queue is empty
+ -----------------------------------------------------------------------------------------------------------------------------*/
+bool QUEUE_get(Queue_Type *a_queue_Ptr , uint8 *a_event_Ptr)
+{
+	uint8 tail = a_queue_Ptr->s_tail;
+	if(tail == a_queue_Ptr->s_head)
+	{
+		return FALSE;
+	}
+	*a_event_Ptr = a_queue_Ptr->s_buffer_Ptr[tail];
+	a_queue_Ptr->s_tail = (tail + 1) & (a_queue_Ptr->s_size - 1);
+	return TRUE;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: QUEUE_peek
+ * [Description]:   function responsible for reading the oldest event of the queue without taking it
+ * [Args]: const Queue_Type *a_queue_Ptr , uint8 *a_event_Ptr
+ * [Returns]: bool : FALSE if the queue is empty
+ -----------------------------------------------------------------------------------------------------------------------------*/
+bool QUEUE_peek(const Queue_Type *a_queue_Ptr , uint8 *a_event_Ptr)
+{
+	uint8 tail = a_queue_Ptr->s_tail;
+	if(tail == a_queue_Ptr->s_head)
+	{
+		return FALSE;
+	}
+	*a_event_Ptr = a_queue_Ptr->s_buffer_Ptr[tail];
+	return TRUE;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: QUEUE_isEmpty
+ * [Description]:   function responsible for checking if the queue is empty , it can be called with the
+ * 					interrupts disabled before sleeping
+ * [Args]: const Queue_Type *a_queue_Ptr
+ * [Returns]: bool
+ -----------------------------------------------------------------------------------------------------------------------------*/
+bool QUEUE_isEmpty(const Queue_Type *a_queue_Ptr)
+{
+	return (a_queue_Ptr->s_head == a_queue_Ptr->s_tail);
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: QUEUE_getFree
+ * [Description]:   function responsible for reading the number of events that can be put now , it is called by
+ * 					the producer so the places can only grow (by the consumer) until it puts the events
+ * [Args]: const Queue_Type *a_queue_Ptr
+ * [Returns]: uint8
+ -----------------------------------------------------------------------------------------------------------------------------*/
+uint8 QUEUE_getFree(const Queue_Type *a_queue_Ptr)
+{
+	return (a_queue_Ptr->s_tail - a_queue_Ptr->s_head - 1) & (a_queue_Ptr->s_size - 1);
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: QUEUE_getOverflows
+ * [Description]:   function responsible for reading the number of events dropped because the queue was full
+ * 					it is two bytes changed by the producer so it is read with the interrupts disabled
+ * [Args]: const Queue_Type *a_queue_Ptr
+ * [Returns]: uint16
+ -----------------------------------------------------------------------------------------------------------------------------*/
+uint16 QUEUE_getOverflows(const Queue_Type *a_queue_Ptr)
+{
+	uint16 overflows;
+	uint8 sreg = SREG;
+	cli();
+	overflows = a_queue_Ptr->s_overflows;
+	SREG = sreg;
+	return overflows;
+}
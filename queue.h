@@ -0,0 +1,51 @@
+ /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Event Queue
+ *
+ * [File Name]: queue.h
+ *
+ * [Description]: header file for the Event Queue , a fixed size queue of bytes that hands the events of the
+ * 				  interrupts (UART , Timer , KeyPad) to the main loop without disabling the interrupts ,
+ * 				  the interrupts put the events and the main loop gets them , the interrupts do not nest
+ * 				  on the AVR so all of them together are one producer and the main loop is the only consumer
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef QUEUE_H_
+#define QUEUE_H_
+
+#include"common_macros.h"
+#include"micro_config.h"
+#include"std_types.h"
+
+/*
+ * Description: structure of a queue
+ * 1. the array of the events , its size should be a power of 2 not more than 128
+ * 2. the size of the array
+ * 3. the index the next event is put at , it is changed only by the producer
+ * 4. the index the next event is taken from , it is changed only by the consumer
+ * 5. the number of events dropped because the queue was full
+ * one place of the array is always left empty to tell the full queue from the empty one
+ */
+typedef struct
+{
+	uint8 *s_buffer_Ptr;
+	uint8 s_size;
+	volatile uint8 s_head;
+	volatile uint8 s_tail;
+	volatile uint16 s_overflows;
+}Queue_Type;
+
+/* Description: the initial value of a queue using the array a_buffer */
+#define QUEUE_INITIALIZER(a_buffer) {a_buffer , sizeof(a_buffer) , 0 , 0 , 0}
+
+bool QUEUE_put(Queue_Type *a_queue_Ptr , uint8 a_event);           /* function prototype for putting an event (producer) */
+bool QUEUE_get(Queue_Type *a_queue_Ptr , uint8 *a_event_Ptr);     /* function prototype for getting an event (consumer) */
+bool QUEUE_peek(const Queue_Type *a_queue_Ptr , uint8 *a_event_Ptr);  /* function prototype for reading the next event */
+bool QUEUE_isEmpty(const Queue_Type *a_queue_Ptr);                /* function prototype for checking if the queue is empty */
+uint8 QUEUE_getFree(const Queue_Type *a_queue_Ptr);               /* function prototype for reading the free places */
+uint16 QUEUE_getOverflows(const Queue_Type *a_queue_Ptr);         /* function prototype for reading the dropped events */
+
+#endif /* QUEUE_H_ */
@@ -0,0 +1,117 @@
+  /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Scheduler
+ *
+ * [File Name]:sched.c
+ *
+ * [Description]: source file for the cooperative Scheduler
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+#include"sched.h"
+
+/*******************************************************************************************************
+ *                                          Global Variables                                           *
+ ******************************************************************************************************/
+/* the table of the tasks and the number of its tasks */
+static Sched_TaskType *g_tasks_Ptr = NULL;
+static uint8 g_numberOfTasks = 0;
+/* the function that returns the time used for the accounting */
+static uint32 (*g_getTime)(void) = NULL;
+/* the ticks counted by the Timer interrupt since the last run */
+static volatile uint8 g_pendingTicks = 0;
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: SCHED_init
+ * [Description]:   function responsible for setting the table of the tasks and the function of the time , the
+ * 					tasks with a period run after their first period
+ * [Args]: Sched_TaskType *a_tasks_Ptr , uint8 a_numberOfTasks , the address of the time function
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void SCHED_init(Sched_TaskType *a_tasks_Ptr , uint8 a_numberOfTasks , uint32 (*a_getTime)(void))
+{
+	uint8 i;
+	g_tasks_Ptr = a_tasks_Ptr;
+	g_numberOfTasks = a_numberOfTasks;
+	g_getTime = a_getTime;
+	for(i=0;i<a_numberOfTasks;i++)
+	{
+		a_tasks_Ptr[i].s_ticksLeft = a_tasks_Ptr[i].s_period;
+		a_tasks_Ptr[i].s_runTime = 0;
+		a_tasks_Ptr[i].s_runs = 0;
+	}
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: SCHED_tick
+ * [Description]:   function responsible for counting a tick , it is called by the Timer interrupt
+ * [Args]: void
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void SCHED_tick(void)
+{
+	if(g_pendingTicks < 0xFF)
+	{
+		g_pendingTicks++;
+	}
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: SCHED_run
+ * [Description]:   function responsible for running every task that is due once in the order of the table
+ * 					it is called by the main loop , the ticks missed while a task was running are taken
+ * 					together so a late task runs once and is not repeated
+ * [Args]: void
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void SCHED_run(void)
+{
+	uint8 i;
+	uint8 ticks;
+	uint32 start;
+	Sched_TaskType *task_Ptr;
+	cli();
+	ticks = g_pendingTicks;
+	g_pendingTicks = 0;
+	sei();
+	for(i=0;i<g_numberOfTasks;i++)
+	{
+		task_Ptr = &g_tasks_Ptr[i];
+		if(task_Ptr->s_period != 0)
+		{
+			if(task_Ptr->s_ticksLeft > ticks)
+			{
+				task_Ptr->s_ticksLeft -= ticks;
+				continue;
+			}
+			task_Ptr->s_ticksLeft = task_Ptr->s_period;
+		}
+		start = g_getTime();
+		task_Ptr->task();
+		task_Ptr->s_runTime += g_getTime() - start;
+		task_Ptr->s_runs++;
+	}
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: SCHED_getRunTime
+ * [Description]:   function responsible for reading the time spent in a task
+ * [Args]: uint8 a_task : the index of the task in the table
+ * [Returns]: uint32
+ -----------------------------------------------------------------------------------------------------------------------------*/
+uint32 SCHED_getRunTime(uint8 a_task)
+{
+	return g_tasks_Ptr[a_task].s_runTime;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: SCHED_getRuns
+ * [Description]:   function responsible for reading the number of runs of a task
+ * [Args]: uint8 a_task : the index of the task in the table
+ * [Returns]: uint16
+ -----------------------------------------------------------------------------------------------------------------------------*/
+uint16 SCHED_getRuns(uint8 a_task)
+{
+	return g_tasks_Ptr[a_task].s_runs;
+}
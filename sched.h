@@ -0,0 +1,55 @@
+ /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Scheduler
+ *
+ * [File Name]: sched.h
+ *
+ * [Description]: header file for the cooperative Scheduler , the tasks are stored in a fixed table and every
+ * 				  task runs to its next wait point and returns so the tasks are interleaved without a stack
+ * 				  for every task , the time of every run of a task is counted to show where the CPU time goes
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef SCHED_H_
+#define SCHED_H_
+
+#include"common_macros.h"
+#include"micro_config.h"
+#include"std_types.h"
+
+/* the point a task waits at , a task keeps it in a static variable that is 0 at the beginning */
+typedef uint16 Sched_PtType;
+
+/* the macros of a task that waits without blocking (protothread) : the task returns at every wait
+ * and the next run continues after it , local variables are lost at a wait so they should be static
+ * and a switch statement can not be used between PT_BEGIN and PT_END */
+#define PT_BEGIN(PT) switch(PT) { case 0:
+#define PT_WAIT_UNTIL(PT , CONDITION) do { (PT) = __LINE__; case __LINE__: if(!(CONDITION)) { return; } } while(0)
+#define PT_YIELD(PT) do { (PT) = __LINE__; return; case __LINE__: ; } while(0)
+#define PT_END(PT) } (PT) = 0
+
+/*
+ * Description: structure of one task of the table
+ * 1. the function of the task
+ * 2. the period of the task in ticks , 0 runs it in every pass of the main loop
+ * 3. the ticks left to the next run
+ * 4. the time spent in the task (in the units of the time function) and the number of its runs
+ */
+typedef struct
+{
+	void (*task)(void);
+	uint8 s_period;
+	uint8 s_ticksLeft;
+	uint32 s_runTime;
+	uint16 s_runs;
+}Sched_TaskType;
+
+void SCHED_init(Sched_TaskType *a_tasks_Ptr , uint8 a_numberOfTasks , uint32 (*a_getTime)(void));  /* function prototype for setting the table of the tasks */
+void SCHED_tick(void);                       /* function prototype for counting a tick from the Timer interrupt */
+void SCHED_run(void);                        /* function prototype for running the tasks that are due */
+uint32 SCHED_getRunTime(uint8 a_task);       /* function prototype for reading the time spent in a task */
+uint16 SCHED_getRuns(uint8 a_task);          /* function prototype for reading the number of runs of a task */
+
+#endif /* SCHED_H_ */
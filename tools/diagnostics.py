@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+"""Print the histograms of the times , the counters and the UART errors answered by the Control ECU
+to DIAGNOSTICS (0x17).
+
+Connect the UART of the Control ECU to a PC (9600 8N1), send the byte 0x17 and save the answer:
+    python3 diagnostics.py answer.bin
+The answer is 0x17 , the length of the data , the data and the XOR of the data , the data is
+LATENCY_BUCKETS counts (high byte first) for every histogram of control_ecu_declerations.h then
+the counters of Control_CountersType and of Uart_ErrorsType (high byte first) .
+"""
+import sys
+
+DIAGNOSTICS = 0x17
+LATENCY_BUCKETS = 16
+# must match the HISTOGRAM_ ids of control_ecu_declerations.h
+NAMES = ["verify", "eeprom", "turnaround", "uart_isr"]
+# must match the fields of Control_CountersType
+COUNTERS = ["unlocks", "wrong_passwords", "lockouts", "emergency_stops", "close_failures"]
+# must match the fields of Uart_ErrorsType
+UART_ERRORS = ["uart_frame_errors", "uart_parity_errors", "uart_overruns"]
+
+
+def bucket_range(bucket):
+    if bucket == 0:
+        return "0 us"
+    low = 1 << (bucket - 1)
+    if bucket == LATENCY_BUCKETS - 1:
+        return ">= %d us" % low
+    return "%d-%d us" % (low, (1 << bucket) - 1)
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: diagnostics.py answer.bin")
+    with open(sys.argv[1], "rb") as answer:
+        data = answer.read()
+    start = data.index(DIAGNOSTICS)
+    length = data[start + 1]
+    body = data[start + 2:start + 2 + length]
+    checksum = 0
+    for byte in body:
+        checksum ^= byte
+    if len(body) != length or data[start + 2 + length] != checksum:
+        sys.exit("the frame is cut or its checksum is wrong")
+    counts = [(body[i] << 8) | body[i + 1] for i in range(0, length, 2)]
+    for index, name in enumerate(NAMES):
+        buckets = counts[index * LATENCY_BUCKETS:(index + 1) * LATENCY_BUCKETS]
+        print("%s (%d)" % (name, sum(buckets)))
+        for bucket, count in enumerate(buckets):
+            if count:
+                print("  %-16s %6d" % (bucket_range(bucket), count))
+    counters = counts[len(NAMES) * LATENCY_BUCKETS:]
+    for name, count in zip(COUNTERS + UART_ERRORS, counters):
+        print("%-18s %6d" % (name, count))
+
+
+if __name__ == "__main__":
+    main()
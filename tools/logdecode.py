@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+"""Decode the tokenized Log of the Control ECU (log.h).
+
+The token table is read from the LOG_MESSAGES list of log.h so it is always the one the
+firmware is built with. Build with LOG_ENABLE 1, save what the UART sends (9600 8N1) and run:
+    python3 logdecode.py capture.bin [path/to/log.h]
+The bytes of the link between the ECUs are printed as they are.
+"""
+import os
+import re
+import sys
+
+LOG_FRAME = 0x18
+MESSAGE = re.compile(r'X\(\s*(\w+)\s*,\s*(\d+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)')
+
+
+def read_table(header):
+    """Return [(name , number of bytes of the arguments , format)] in the order of the tokens."""
+    with open(header) as source:
+        text = source.read()
+    start = text.index("#define LOG_MESSAGES(X)")
+    end = text.index("\n\n", start)
+    return [(name, int(size), fmt) for name, size, fmt in MESSAGE.findall(text[start:end])]
+
+
+def format_message(fmt, args):
+    fields = fmt.count("%u")
+    if fields == 1:
+        return fmt % int.from_bytes(args, "big")
+    return fmt % tuple(args[:fields])
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        sys.exit("usage: logdecode.py capture.bin [log.h]")
+    header = sys.argv[2] if len(sys.argv) == 3 else os.path.join(os.path.dirname(__file__), "..", "log.h")
+    table = read_table(header)
+    with open(sys.argv[1], "rb") as capture:
+        data = capture.read()
+    index = 0
+    while index < len(data):
+        if data[index] == LOG_FRAME and index + 2 < len(data):
+            token = (data[index + 1] << 8) | data[index + 2]
+            if token < len(table):
+                name, size, fmt = table[token]
+                args = data[index + 3:index + 3 + size]
+                if len(args) == size:
+                    print("%-20s %s" % (name, format_message(fmt, args)))
+                    index += 3 + size
+                    continue
+        print("%-20s 0x%02X" % ("link", data[index]))
+        index += 1
+
+
+if __name__ == "__main__":
+    main()
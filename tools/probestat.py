@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+"""Summarize the probes of the hot paths dumped by the Control ECU (probe.h).
+
+Build with PROBE_ENABLE 1, connect the UART of the Control ECU to a PC (9600 8N1),
+send the byte 0x16 (PROBE_DUMP) and save the answer, for example:
+    python3 probestat.py dump.bin
+The answer is 0x16 , the number of probes , then 3 bytes for every probe :
+the id (bit 7 set at the exit) and the counter of Timer 1 , high byte first.
+"""
+import sys
+
+PROBE_DUMP = 0x16
+PROBE_EXIT_FLAG = 0x80
+# the counter of Timer 1 counts micro seconds from 0 to TICK_COMPARE_VALUE (8 ms tick)
+TIMER_PERIOD = 8000
+# must match the probe ids of probe.h
+NAMES = ["uart_rx_isr", "tick_isr", "eeprom_read", "compare", "lcd_command", "lcd_data"]
+
+
+def parse(data):
+    start = data.index(PROBE_DUMP)
+    count = data[start + 1]
+    body = data[start + 2:start + 2 + 3 * count]
+    return [(body[i], (body[i + 1] << 8) | body[i + 2]) for i in range(0, len(body) - 2, 3)]
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: probestat.py dump.bin")
+    with open(sys.argv[1], "rb") as dump:
+        probes = parse(dump.read())
+    # the probes nest (an interrupt inside a function) so match every exit with the last open enter
+    open_probes = []
+    costs = {}
+    for probe_id, time in probes:
+        if probe_id & PROBE_EXIT_FLAG:
+            probe_id &= ~PROBE_EXIT_FLAG
+            for index in range(len(open_probes) - 1, -1, -1):
+                if open_probes[index][0] == probe_id:
+                    enter = open_probes.pop(index)[1]
+                    costs.setdefault(probe_id, []).append((time - enter) % TIMER_PERIOD)
+                    break
+        else:
+            open_probes.append((probe_id, time))
+    print("%-12s %6s %8s %8s %8s" % ("probe", "count", "min us", "mean us", "max us"))
+    for probe_id in sorted(costs):
+        values = costs[probe_id]
+        name = NAMES[probe_id] if probe_id < len(NAMES) else str(probe_id)
+        print("%-12s %6d %8d %8.1f %8d" % (name, len(values), min(values), sum(values) / len(values), max(values)))
+
+
+if __name__ == "__main__":
+    main()
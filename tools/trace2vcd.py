@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+"""Convert a dump of the signal trace (g_trace in trace.h) to a Value Change Dump.
+
+Dump the ring from the Control ECU with the debugger, for example in avr-gdb:
+    dump binary value trace.bin g_trace
+then run:
+    python3 trace2vcd.py trace.bin > trace.vcd
+and open trace.vcd in any waveform viewer (GTKWave ...).
+"""
+import struct
+import sys
+
+# must match TRACE_SIZE and the signals of trace.h : (name , width in bits)
+TRACE_SIZE = 32
+SIGNALS = [
+    ("uart_rx", 8),
+    ("uart_tx", 8),
+    ("twi_busy", 1),
+    ("motor_duty", 8),
+    ("buzzer_pattern", 8),
+    ("door_switch", 8),
+    ("fsm_event", 8),
+    ("fsm_state", 8),
+]
+RECORD = struct.Struct("<IBB")  # uint32 time , uint8 signal , uint8 value (the AVR does not pad)
+
+
+def read_records(data):
+    """Return the recorded changes from the oldest to the newest."""
+    next_index, count = data[RECORD.size * TRACE_SIZE], data[RECORD.size * TRACE_SIZE + 1]
+    first = (next_index - count) % TRACE_SIZE
+    records = []
+    for i in range(count):
+        offset = ((first + i) % TRACE_SIZE) * RECORD.size
+        records.append(RECORD.unpack_from(data, offset))
+    return records
+
+
+def value(width, number):
+    return "%d" % (number & 1) if width == 1 else "b{:b} ".format(number)
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: trace2vcd.py trace.bin > trace.vcd")
+    with open(sys.argv[1], "rb") as dump:
+        records = read_records(dump.read())
+    out = sys.stdout
+    out.write("$timescale 1us $end\n$scope module control_ecu $end\n")
+    for index, (name, width) in enumerate(SIGNALS):
+        out.write("$var wire %d %s %s $end\n" % (width, chr(33 + index), name))
+    out.write("$upscope $end\n$enddefinitions $end\n")
+    # the time wraps after 2^32 us , keep it growing through the wrap
+    base = records[0][0] if records else 0
+    for time, signal, number in records:
+        if signal >= len(SIGNALS):
+            continue
+        width = SIGNALS[signal][1]
+        out.write("#%d\n%s%s\n" % ((time - base) & 0xFFFFFFFF, value(width, number), chr(33 + signal)))
+
+
+if __name__ == "__main__":
+    main()
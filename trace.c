@@ -0,0 +1,77 @@
+  /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Signal Trace
+ *
+ * [File Name]:trace.c
+ *
+ * [Description]: source file for the Signal Trace
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+#include"trace.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+Trace_BufferType g_trace;
+/* the function giving the time of a change , nothing is recorded before TRACE_init */
+static uint32 (*volatile g_getTime)(void) = NULL;
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: TRACE_init
+ * [Description]:   function responsible for starting the recording with the time function of the ECU , an ECU
+ * 					that does not call it pays only one check in every driver
+ * [Args]: uint32 (*a_getTime)(void)
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void TRACE_init(uint32 (*a_getTime)(void))
+{
+	TRACE_clear();
+	g_getTime = a_getTime;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: TRACE_record
+ * [Description]:   function responsible for recording one change with its time , it is called from the
+ * 					interrupts and the main loop so the ring is changed with the interrupts disabled ,
+ * 					the oldest change is overwritten when the ring is full
+ * [Args]: uint8 a_signal , uint8 a_value
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void TRACE_record(uint8 a_signal , uint8 a_value)
+{
+	Trace_RecordType *record_Ptr;
+	uint8 sreg;
+	if(g_getTime == NULL)
+	{
+		return;
+	}
+	sreg = SREG;
+	cli();
+	record_Ptr = &g_trace.s_records[g_trace.s_next];
+	record_Ptr->time = g_getTime();
+	record_Ptr->signal = a_signal;
+	record_Ptr->value = a_value;
+	g_trace.s_next = (g_trace.s_next + 1) & (TRACE_SIZE - 1);
+	if(g_trace.s_count < TRACE_SIZE)
+	{
+		g_trace.s_count++;
+	}
+	SREG = sreg;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------
+ * [Function Name]: TRACE_clear
+ * [Description]:   function responsible for dropping the recorded changes
+ * [Args]: void
+ * [Returns]: void
+ -----------------------------------------------------------------------------------------------------------------------------*/
+void TRACE_clear(void)
+{
+	uint8 sreg = SREG;
+	cli();
+	g_trace.s_next = 0;
+	g_trace.s_count = 0;
+	SREG = sreg;
+}
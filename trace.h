@@ -0,0 +1,76 @@
+ /*----------------------------------------------------------------------------------------------------------------------------
+ *
+ * [Module]: Signal Trace
+ *
+ * [File Name]: trace.h
+ *
+ * [Description]: header file for the Signal Trace , the drivers record every change of the UART , the I2C , the
+ * 				  motor , the buzzer and the end stops with its time in a ring of fixed size records so the
+ * 				  last changes before a problem can be dumped from the RAM (g_trace) with the debugger and
+ * 				  converted to a Value Change Dump by tools/trace2vcd.py to see them on one time line
+ *
+ * [Author]:  Shady Ali
+ *
+------------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include"common_macros.h"
+#include"micro_config.h"
+#include"std_types.h"
+
+/* set to 0 to remove the recording from all the drivers */
+#define TRACE_ENABLE 1
+
+/* the number of the last changes kept , it should be a power of 2 (6 bytes each) */
+#define TRACE_SIZE 32
+
+/* the signals , tools/trace2vcd.py has the same list */
+#define TRACE_UART_RX 0       /* a byte is received , the value is the byte */
+#define TRACE_UART_TX 1       /* a byte is sent , the value is the byte */
+#define TRACE_TWI 2           /* 1 when a start condition is sent and 0 when a stop condition is sent */
+#define TRACE_MOTOR 3         /* the duty cycle of the motor , 0 when it is stopped */
+#define TRACE_BUZZER 4        /* the played pattern + 1 , 0 when the buzzer is stopped */
+#define TRACE_DOOR_SWITCH 5   /* the end of the door that is arrived at */
+#define TRACE_FSM_EVENT 6     /* the event of a transition of the state machine */
+#define TRACE_FSM_STATE 7     /* the state after a transition of the state machine */
+
+#if TRACE_ENABLE
+#define TRACE_SIGNAL(a_signal , a_value) TRACE_record((a_signal) , (a_value))
+#else
+#define TRACE_SIGNAL(a_signal , a_value)
+#endif
+
+/*
+ * Description: structure of one change (6 bytes)
+ * 1. the time of the change in the unit of the time function given to TRACE_init
+ * 2. the signal that changed
+ * 3. the new value of the signal
+ */
+typedef struct
+{
+	uint32 time;
+	uint8 signal;
+	uint8 value;
+}Trace_RecordType;
+
+/*
+ * Description: structure of the ring of the changes , s_next is the place of the next change and the oldest
+ * change when s_count is TRACE_SIZE
+ */
+typedef struct
+{
+	Trace_RecordType s_records[TRACE_SIZE];
+	uint8 s_next;
+	uint8 s_count;
+}Trace_BufferType;
+
+/* the ring is global so the debugger can dump it by its name */
+extern Trace_BufferType g_trace;
+
+void TRACE_init(uint32 (*a_getTime)(void));             /* function prototype for starting the recording */
+void TRACE_record(uint8 a_signal , uint8 a_value);       /* function prototype for recording a change */
+void TRACE_clear(void);                                  /* function prototype for dropping the recorded changes */
+
+#endif /* TRACE_H_ */